@@ -0,0 +1,185 @@
+/// @file    ConcurrentUuidMapBench.cpp
+/// @author  Matthew Green
+/// @date    2026-10-18 23:05:47
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/common/ConcurrentUuidMap.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+using namespace velecs::common;
+
+namespace {
+
+/// @brief Keys the maps are filled with before every run
+constexpr size_t KEY_COUNT = 100'000;
+
+/// @brief Thread counts measured, capped by the maxThreads argument
+constexpr unsigned THREAD_COUNTS[] = { 1, 2, 4, 8, 16, 32, 64 };
+
+/// @brief Read/write proportions of one benchmark run
+struct Mix {
+    const char* name;
+    unsigned writePercent;
+};
+
+constexpr Mix MIXES[] = {
+    { "read-heavy (95/5)", 5 },
+    { "write-heavy (50/50)", 50 },
+};
+
+/// @brief The baseline the map replaces: one mutex around a std::unordered_map
+class LockedMap {
+public:
+    bool TryGet(const Uuid& key, uint64_t& outValue) const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto it = _map.find(key);
+        if (it == _map.end()) return false;
+
+        outValue = it->second;
+        return true;
+    }
+
+    bool Insert(const Uuid& key, uint64_t value)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _map.emplace(key, value).second;
+    }
+
+    bool Remove(const Uuid& key)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _map.erase(key) != 0;
+    }
+
+private:
+    mutable std::mutex _mutex;
+    std::unordered_map<Uuid, uint64_t> _map;
+};
+
+/// @brief Small per-thread generator for key indices and the read/write choice
+struct XorShift {
+    uint64_t state;
+
+    uint64_t Next()
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return state;
+    }
+};
+
+/// @brief Runs one mix on one map with a fixed number of threads
+/// @return Total operations per second across all threads
+/// @details Reads are TryGet on a random key. A write removes a random key, or inserts it again if
+///          it was already removed, so the population stays near KEY_COUNT.
+template<typename Map>
+double Run(Map& map, const std::vector<Uuid>& keys, const Mix& mix, unsigned threadCount,
+    std::chrono::milliseconds duration)
+{
+    std::atomic<bool> start{false};
+    std::atomic<bool> stop{false};
+    std::vector<uint64_t> operations(threadCount, 0);
+    std::vector<std::thread> threads;
+
+    for (unsigned t = 0; t < threadCount; ++t)
+    {
+        threads.emplace_back([&, t]() {
+            XorShift rng{ 0x9E3779B97F4A7C15ull * (t + 1) };
+            uint64_t count = 0;
+            uint64_t sink = 0;
+
+            while (!start.load(std::memory_order_acquire)) std::this_thread::yield();
+            while (!stop.load(std::memory_order_relaxed))
+            {
+                // Check the stop flag every 64 operations so it stays out of the measurement
+                for (int i = 0; i < 64; ++i)
+                {
+                    const uint64_t random = rng.Next();
+                    const Uuid& key = keys[random % keys.size()];
+                    if ((random >> 32) % 100 < mix.writePercent)
+                    {
+                        if (!map.Remove(key)) map.Insert(key, random);
+                    }
+                    else
+                    {
+                        uint64_t value = 0;
+                        if (map.TryGet(key, value)) sink += value;
+                    }
+                }
+                count += 64;
+            }
+
+            operations[t] = count + (sink & 1);
+        });
+    }
+
+    const auto begin = std::chrono::steady_clock::now();
+    start.store(true, std::memory_order_release);
+    std::this_thread::sleep_for(duration);
+    stop.store(true, std::memory_order_relaxed);
+    for (auto& thread : threads) thread.join();
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+    uint64_t total = 0;
+    for (uint64_t count : operations) total += count;
+    return static_cast<double>(total) / seconds;
+}
+
+template<typename Map>
+double RunFresh(const std::vector<Uuid>& keys, const Mix& mix, unsigned threadCount,
+    std::chrono::milliseconds duration)
+{
+    Map map;
+    for (size_t i = 0; i < keys.size(); ++i) map.Insert(keys[i], i);
+    return Run(map, keys, mix, threadCount, duration);
+}
+
+} // namespace
+
+/// @brief Compares ConcurrentUuidMap against a mutex-guarded std::unordered_map
+/// @details Usage: ConcurrentUuidMapBench [durationMs = 500] [maxThreads = 64]. Thread counts above the
+///          machine's hardware concurrency are still run, but only measure oversubscription.
+int main(int argc, char** argv)
+{
+    const std::chrono::milliseconds duration(argc > 1 ? std::atoi(argv[1]) : 500);
+    const unsigned maxThreads = argc > 2 ? static_cast<unsigned>(std::atoi(argv[2])) : 64;
+
+    std::vector<Uuid> keys;
+    keys.reserve(KEY_COUNT);
+    for (size_t i = 0; i < KEY_COUNT; ++i) keys.push_back(Uuid::GenerateRandom());
+
+    std::printf("hardware threads: %u, keys: %zu, %lld ms per run\n",
+        std::thread::hardware_concurrency(), KEY_COUNT, static_cast<long long>(duration.count()));
+    std::printf("%-20s %8s %20s %20s %8s\n", "mix", "threads", "ConcurrentUuidMap", "mutex+unordered_map", "speedup");
+
+    for (const Mix& mix : MIXES)
+    {
+        for (unsigned threadCount : THREAD_COUNTS)
+        {
+            if (threadCount > maxThreads) break;
+
+            const double concurrent = RunFresh<ConcurrentUuidMap<uint64_t>>(keys, mix, threadCount, duration);
+            const double locked = RunFresh<LockedMap>(keys, mix, threadCount, duration);
+            std::printf("%-20s %8u %14.2f Mop/s %14.2f Mop/s %7.2fx\n",
+                mix.name, threadCount, concurrent / 1e6, locked / 1e6, concurrent / locked);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,61 @@
+/// @file    BitOps.hpp
+/// @author  Matthew Green
+/// @date    2026-10-18 18:27:13
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include <cstdint>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace velecs::common {
+
+/// @brief Counts the zero bits below the lowest set bit
+/// @param value Word to scan; must not be zero
+/// @return Index of the lowest set bit
+inline unsigned CountTrailingZeros(uint64_t value) noexcept
+{
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanForward64(&index, value);
+    return static_cast<unsigned>(index);
+#else
+    return static_cast<unsigned>(__builtin_ctzll(value));
+#endif
+}
+
+/// @brief Counts the set bits in a word
+/// @param value Word to count
+/// @return Number of set bits
+inline unsigned PopCount(uint64_t value) noexcept
+{
+#ifdef _MSC_VER
+    return static_cast<unsigned>(__popcnt64(value));
+#else
+    return static_cast<unsigned>(__builtin_popcountll(value));
+#endif
+}
+
+/// @brief Calls a function with the index of every set bit in a word, lowest first
+/// @param word Word to scan
+/// @param base Value added to each bit index before it is passed on
+/// @param func Callable taking the resulting index
+template<typename Func>
+inline void ForEachSetBit(uint64_t word, uint64_t base, Func&& func)
+{
+    while (word != 0)
+    {
+        func(base + CountTrailingZeros(word));
+        word &= word - 1;
+    }
+}
+
+} // namespace velecs::common
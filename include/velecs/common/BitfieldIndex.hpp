@@ -0,0 +1,175 @@
+/// @file    BitfieldIndex.hpp
+/// @author  Matthew Green
+/// @date    2026-10-18 18:27:13
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/common/BitfieldEnum.hpp"
+#include "velecs/common/RoaringBitmap.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace velecs::common {
+
+/// @class BitfieldIndex
+/// @brief A column of bitfield enum values with one compressed row bitmap per flag bit.
+///
+/// Instead of scanning every row with HasAnyFlag/HasAllFlags, queries combine the per-bit
+/// bitmaps, so a selective query costs roughly the size of its result. Updating a row only
+/// touches the bitmaps of the bits that changed.
+///
+/// @tparam E Enum type with EnableBitfieldEnum specialized
+///
+/// @code
+/// BitfieldIndex<MyFlags> index;
+/// uint32_t row = index.Append(MyFlags::Flag1 | MyFlags::Flag3);
+/// index.Set(row, MyFlags::Flag2);
+///
+/// // Rows with Flag1 and Flag2 set but not Flag3
+/// RoaringBitmap rows = index.Without(index.AllOf(MyFlags::Flag1 | MyFlags::Flag2), MyFlags::Flag3);
+/// @endcode
+template<typename E>
+class BitfieldIndex {
+    static_assert(is_bitfield_enum_v<E>, "BitfieldIndex requires an enum with EnableBitfieldEnum specialized");
+
+    using Underlying = std::make_unsigned_t<std::underlying_type_t<E>>;
+
+public:
+    // Enums
+
+    // Public Fields
+
+    /// @brief Number of flag bits in E
+    static constexpr unsigned BIT_COUNT = sizeof(Underlying) * 8;
+
+    // Constructors and Destructors
+
+    /// @brief Default constructor. Creates an index with no rows.
+    BitfieldIndex() = default;
+
+    /// @brief Default deconstructor.
+    ~BitfieldIndex() = default;
+
+    // Public Methods
+
+    /// @brief Appends a row
+    /// @param flags Flags of the new row
+    /// @return Id of the new row
+    uint32_t Append(E flags)
+    {
+        uint32_t row = static_cast<uint32_t>(_rows.size());
+        _rows.push_back(E{});
+        Set(row, flags);
+        return row;
+    }
+
+    /// @brief Changes the flags of a row, growing the column with empty rows if needed
+    /// @param row Row id
+    /// @param flags New flags
+    void Set(uint32_t row, E flags)
+    {
+        if (row >= _rows.size()) _rows.resize(static_cast<size_t>(row) + 1, E{});
+
+        Underlying before = static_cast<Underlying>(_rows[row]);
+        Underlying after = static_cast<Underlying>(flags);
+        _rows[row] = flags;
+
+        Underlying changed = before ^ after;
+        ForEachSetBit(changed, 0, [&](uint64_t bit) {
+            if ((after >> bit) & 1) _bitmaps[bit].Add(row);
+            else _bitmaps[bit].Remove(row);
+        });
+    }
+
+    /// @brief Gets the flags of a row
+    /// @throws std::out_of_range if the row does not exist
+    E Get(uint32_t row) const
+    {
+        if (row >= _rows.size()) throw std::out_of_range("BitfieldIndex::Get() row out of range");
+        return _rows[row];
+    }
+
+    /// @brief Gets the number of rows
+    size_t RowCount() const { return _rows.size(); }
+
+    /// @brief Gets the rows that have any of the given flags set (HasAnyFlag)
+    RoaringBitmap AnyOf(E flags) const
+    {
+        RoaringBitmap result;
+        ForEachSetBit(static_cast<Underlying>(flags), 0, [&](uint64_t bit) {
+            result = RoaringBitmap::Or(result, _bitmaps[bit]);
+        });
+        return result;
+    }
+
+    /// @brief Gets the rows that have all of the given flags set (HasAllFlags)
+    /// @note Intersects the sparsest bitmaps first; passing no flags returns every row
+    RoaringBitmap AllOf(E flags) const
+    {
+        Underlying bits = static_cast<Underlying>(flags);
+        if (bits == 0)
+        {
+            RoaringBitmap all;
+            all.AddRange(0, static_cast<uint32_t>(_rows.size()));
+            return all;
+        }
+
+        std::vector<const RoaringBitmap*> inputs;
+        ForEachSetBit(bits, 0, [&](uint64_t bit) { inputs.push_back(&_bitmaps[bit]); });
+        std::sort(inputs.begin(), inputs.end(), [](const RoaringBitmap* a, const RoaringBitmap* b) {
+            return a->Cardinality() < b->Cardinality();
+        });
+
+        RoaringBitmap result = *inputs[0];
+        for (size_t i = 1; i < inputs.size() && !result.Empty(); ++i)
+        {
+            result = RoaringBitmap::And(result, *inputs[i]);
+        }
+        return result;
+    }
+
+    /// @brief Removes the rows that have any of the given flags set
+    /// @param rows Candidate rows, typically from AnyOf or AllOf
+    /// @param flags Flags that exclude a row
+    RoaringBitmap Without(const RoaringBitmap& rows, E flags) const
+    {
+        RoaringBitmap result = rows;
+        ForEachSetBit(static_cast<Underlying>(flags), 0, [&](uint64_t bit) {
+            result = RoaringBitmap::AndNot(result, _bitmaps[bit]);
+        });
+        return result;
+    }
+
+    /// @brief Gets the rows that have one flag bit set
+    /// @param bit Bit position, less than BIT_COUNT
+    const RoaringBitmap& RowsWithBit(unsigned bit) const { return _bitmaps[bit]; }
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    /// @brief Flags of each row
+    std::vector<E> _rows;
+
+    /// @brief Rows having each bit set
+    std::array<RoaringBitmap, BIT_COUNT> _bitmaps;
+
+    // Private Methods
+};
+
+} // namespace velecs::common
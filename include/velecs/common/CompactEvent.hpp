@@ -0,0 +1,350 @@
+/// @file    CompactEvent.hpp
+/// @author  Matthew Green
+/// @date    2026-10-18 09:41:05
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include <functional>
+#include <atomic>
+#include <new>
+#include <cstddef>
+#include <thread>
+
+namespace velecs::common {
+
+/// @class CompactEvent
+/// @brief A pointer-sized event for objects that usually have no subscribers.
+///
+/// Behaves like Event (same Add/Remove/Invoke semantics and handle scheme) but stores its
+/// callbacks in an intrusive singly linked list whose nodes come from a pool shared by every
+/// CompactEvent with the same signature. An event with no subscribers is a single null pointer,
+/// so embedding "destroyed"/"changed" signals in large numbers of objects costs 8 bytes each
+/// instead of a 24-byte std::vector.
+///
+/// @tparam Args Parameter types that will be passed to all registered callbacks
+///
+/// @code
+/// struct Entity {
+///     CompactEvent<Entity&> destroyed;   // sizeof(destroyed) == sizeof(void*)
+/// };
+///
+/// auto handle = entity.destroyed += [](Entity& e) { /* ... */ };
+/// entity.destroyed(entity);
+/// entity.destroyed -= handle;
+/// @endcode
+template<typename... Args>
+class CompactEvent {
+public:
+    /// @brief Type alias for callback functions that can be registered with this event
+    using Callback = std::function<void(Args...)>;
+    
+    /// @brief Handle type returned when registering callbacks, used for removal
+    using Handle = size_t;
+
+private:
+    /// @brief Intrusive list node holding one registered callback
+    struct ListenerNode {
+        ListenerNode* next;
+        Handle handle;
+        Callback callback;
+    };
+
+    /// @brief Process-wide free list of listener nodes shared by all events of this signature
+    /// @details Constant-initialized and trivially destructible, so events with static storage
+    ///          duration can safely use it during both startup and shutdown. Storage is carved
+    ///          from chunks that are retained for reuse for the lifetime of the process.
+    class NodePool {
+    public:
+        /// @brief Constructs a node from pooled storage
+        /// @param handle Handle of the callback
+        /// @param callback Callback to store
+        /// @return Pointer to the new node
+        ListenerNode* Allocate(Handle handle, const Callback& callback)
+        {
+            void* storage = Pop();
+            try
+            {
+                return new (storage) ListenerNode{ nullptr, handle, callback };
+            }
+            catch (...)
+            {
+                Push(storage);
+                throw;
+            }
+        }
+
+        /// @brief Destroys a node and returns its storage to the pool
+        /// @param node Node previously returned by Allocate()
+        void Release(ListenerNode* node)
+        {
+            node->~ListenerNode();
+            Push(node);
+        }
+
+    private:
+        /// @brief Storage cell of a free node; reuses the node's own memory as the free list link
+        union FreeCell {
+            FreeCell* next;
+            alignas(ListenerNode) unsigned char storage[sizeof(ListenerNode)];
+        };
+
+        /// @brief Number of nodes carved from each chunk
+        static constexpr size_t CHUNK_NODES = 64;
+
+        std::atomic_flag _lock = ATOMIC_FLAG_INIT;
+        FreeCell* _freeList{nullptr};
+
+        /// @brief Takes a free cell, allocating a new chunk when the pool is exhausted
+        /// @return Uninitialized storage for one node
+        void* Pop()
+        {
+            Lock();
+            if (_freeList == nullptr)
+            {
+                FreeCell* chunk = nullptr;
+                try
+                {
+                    chunk = static_cast<FreeCell*>(::operator new(sizeof(FreeCell) * CHUNK_NODES));
+                }
+                catch (...)
+                {
+                    Unlock();
+                    throw;
+                }
+
+                for (size_t i = 0; i < CHUNK_NODES; ++i)
+                {
+                    chunk[i].next = (i + 1 < CHUNK_NODES) ? &chunk[i + 1] : nullptr;
+                }
+                _freeList = chunk;
+            }
+
+            FreeCell* cell = _freeList;
+            _freeList = cell->next;
+            Unlock();
+            return cell;
+        }
+
+        /// @brief Returns a cell to the free list
+        /// @param storage Storage previously returned by Pop()
+        void Push(void* storage)
+        {
+            FreeCell* cell = static_cast<FreeCell*>(storage);
+            Lock();
+            cell->next = _freeList;
+            _freeList = cell;
+            Unlock();
+        }
+
+        /// @note Yields while contended, since the holder may be inside operator new; Invoke() never takes it
+        void Lock() { while (_lock.test_and_set(std::memory_order_acquire)) { std::this_thread::yield(); } }
+        void Unlock() { _lock.clear(std::memory_order_release); }
+    };
+
+public:
+    // Enums
+
+    // Public Fields
+
+    // Constructors and Destructors
+
+    /// @brief Default constructor. Creates an empty event with no registered callbacks.
+    CompactEvent() = default;
+
+    /// @brief Copy constructor. Copies every registered callback and handle, preserving order.
+    /// @param other The event to copy from
+    CompactEvent(const CompactEvent& other)
+    {
+        CopyFrom(other);
+    }
+
+    /// @brief Move constructor. Takes over the other event's callbacks.
+    /// @param other The event to move from; left empty
+    CompactEvent(CompactEvent&& other) noexcept : _head(other._head)
+    {
+        other._head = nullptr;
+    }
+
+    /// @brief Destructor. Returns all listener nodes to the shared pool.
+    ~CompactEvent() { Clear(); }
+
+    // Public Methods
+
+    /// @brief Copy assignment operator
+    /// @param other The event to copy from
+    /// @return Reference to this event
+    CompactEvent& operator=(const CompactEvent& other)
+    {
+        if (this != &other)
+        {
+            Clear();
+            CopyFrom(other);
+        }
+        return *this;
+    }
+
+    /// @brief Move assignment operator
+    /// @param other The event to move from; left empty
+    /// @return Reference to this event
+    CompactEvent& operator=(CompactEvent&& other) noexcept
+    {
+        if (this != &other)
+        {
+            Clear();
+            _head = other._head;
+            other._head = nullptr;
+        }
+        return *this;
+    }
+
+    /// @brief Adds a callback function to this event
+    /// @param callback The function to be called when this event is invoked
+    /// @return Handle that can be used to remove this specific callback later
+    /// @note The callback will be stored and called in the order it was added
+    /// @note Handle generation is thread-safe using atomic operations
+    Handle Add(const Callback& callback)
+    {
+        static std::atomic<size_t> globalHandleCounter{1};
+        Handle handle = globalHandleCounter.fetch_add(1);
+        Append(Pool().Allocate(handle, callback));
+        return handle;
+    }
+
+    /// @brief Adds a callback function to this event using operator overloading
+    /// @param callback The function to be called when this event is invoked
+    /// @return Handle that can be used to remove this specific callback later
+    /// @note Equivalent to Add(callback). Provides C#-like syntax: auto handle = event += callback
+    Handle operator+=(const Callback& callback)
+    {
+        return Add(callback);
+    }
+
+    /// @brief Removes a specific callback function from this event using its handle
+    /// @param handle The handle returned when the callback was originally added
+    /// @return Reference to this CompactEvent for method chaining
+    /// @note If the handle is not found, this method has no effect
+    /// @note Must not be called from a callback while this event is being invoked
+    CompactEvent& Remove(Handle handle)
+    {
+        for (ListenerNode** link = &_head; *link != nullptr; link = &(*link)->next)
+        {
+            if ((*link)->handle == handle)
+            {
+                ListenerNode* node = *link;
+                *link = node->next;
+                Pool().Release(node);
+                break;
+            }
+        }
+        return *this;
+    }
+
+    /// @brief Removes a specific callback function from this event using operator overloading
+    /// @param handle The handle returned when the callback was originally added
+    /// @return Reference to this CompactEvent for method chaining
+    /// @note Equivalent to Remove(handle). Provides C#-like syntax: event -= handle
+    CompactEvent& operator-=(Handle handle)
+    {
+        return Remove(handle);
+    }
+
+    /// @brief Removes all registered callback functions from this event
+    /// @note Handle counter is not reset to ensure uniqueness across all CompactEvent instances
+    void Clear()
+    {
+        ListenerNode* node = _head;
+        _head = nullptr;
+        while (node != nullptr)
+        {
+            ListenerNode* next = node->next;
+            Pool().Release(node);
+            node = next;
+        }
+    }
+
+    /// @brief Invokes all registered callback functions with the provided arguments
+    /// @param args Arguments to pass to each registered callback function
+    /// @note Callbacks are called in the order they were registered. If a callback throws an exception,
+    ///       subsequent callbacks will not be executed.
+    /// @note Callbacks must not Remove() or Clear() listeners of this event, including themselves, while it is
+    ///       being invoked: removal destroys the node immediately, which may be the running callback or the next
+    ///       one to run. Defer removal until Invoke returns (e.g. through a ThreadExecutor or TimerWheel).
+    void Invoke(Args... args) const
+    {
+        for (ListenerNode* node = _head; node != nullptr; node = node->next)
+        {
+            node->callback(args...);
+        }
+    }
+
+    /// @brief Invokes all registered callback functions using function call operator
+    /// @param args Arguments to pass to each registered callback function
+    /// @note Equivalent to Invoke(args...). Allows calling the event like a function: event(args...)
+    void operator()(Args... args) const { Invoke(args...); }
+
+    /// @brief Checks if this event has no registered callbacks
+    /// @return true if no callbacks are registered, false otherwise
+    bool Empty() const { return _head == nullptr; }
+
+    /// @brief Gets the number of registered callbacks
+    /// @return The number of callback functions currently registered with this event
+    /// @note This operation is O(n) as it walks the listener list
+    size_t Size() const
+    {
+        size_t count = 0;
+        for (const ListenerNode* node = _head; node != nullptr; node = node->next) ++count;
+        return count;
+    }
+
+private:
+    // Private Fields
+
+    /// @brief First node of the listener list, or nullptr when there are no subscribers
+    ListenerNode* _head{nullptr};
+
+    /// @brief Node pool shared by every CompactEvent with this signature
+    inline static NodePool _pool;
+
+    // Private Methods
+
+    /// @brief Gets the shared node pool
+    /// @return Reference to the pool
+    static NodePool& Pool() { return _pool; }
+
+    /// @brief Links a node at the end of the list so callbacks run in registration order
+    /// @param node The node to append
+    void Append(ListenerNode* node)
+    {
+        ListenerNode** link = &_head;
+        while (*link != nullptr) link = &(*link)->next;
+        *link = node;
+    }
+
+    /// @brief Appends copies of another event's callbacks to this event
+    /// @param other The event to copy from
+    void CopyFrom(const CompactEvent& other)
+    {
+        ListenerNode** link = &_head;
+        for (const ListenerNode* node = other._head; node != nullptr; node = node->next)
+        {
+            try
+            {
+                *link = Pool().Allocate(node->handle, node->callback);
+            }
+            catch (...)
+            {
+                Clear();
+                throw;
+            }
+            link = &(*link)->next;
+        }
+    }
+};
+
+} // namespace velecs::common
@@ -0,0 +1,470 @@
+/// @file    ConcurrentUuidMap.hpp
+/// @author  Matthew Green
+/// @date    2026-10-18 15:26:33
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/common/Uuid.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace velecs::common {
+
+/// @class EpochReclaimer
+/// @brief Epoch-based memory reclamation for lock-free readers.
+///
+/// Readers wrap their accesses in a Guard. Writers unlink an object so no new reader can reach
+/// it, then Retire() it; the object is freed once every reader that might still hold it has left
+/// its guard. Shared by every ConcurrentUuidMap in the process.
+class EpochReclaimer {
+public:
+    // Enums
+
+    // Public Fields
+
+    /// @brief Function that frees a retired object
+    using Deleter = void (*)(void*);
+
+    /// @class Guard
+    /// @brief Keeps objects reachable at construction time alive until destruction. Nestable.
+    class Guard {
+    public:
+        Guard() { Enter(); }
+        ~Guard() { Exit(); }
+
+        Guard(const Guard&) = delete;
+        Guard& operator=(const Guard&) = delete;
+    };
+
+    // Constructors and Destructors
+
+    /// @brief Default constructor.
+    EpochReclaimer() = default;
+
+    /// @brief Default deconstructor.
+    ~EpochReclaimer() = default;
+
+    // Public Methods
+
+    /// @brief Marks the calling thread as reading shared objects
+    /// @note Prefer Guard; calls must be balanced with Exit()
+    static void Enter();
+
+    /// @brief Marks the calling thread as no longer reading shared objects
+    static void Exit();
+
+    /// @brief Schedules an unlinked object to be freed once no reader can still hold it
+    /// @param pointer The object, already unreachable for new readers
+    /// @param deleter Function that frees the object
+    static void Retire(void* pointer, Deleter deleter);
+
+    /// @brief Schedules an unlinked object to be deleted once no reader can still hold it
+    /// @tparam T Type of the object, deleted with `delete`
+    /// @param pointer The object, already unreachable for new readers
+    template<typename T>
+    static void Retire(T* pointer)
+    {
+        Retire(static_cast<void*>(pointer), [](void* object) { delete static_cast<T*>(object); });
+    }
+
+    /// @brief Advances the epoch if possible and frees the calling thread's reclaimable objects
+    static void Collect();
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    // Private Methods
+};
+
+/// @class ConcurrentUuidMap
+/// @brief Hash map from Uuid to V with lock-free reads and per-shard writers.
+///
+/// Keys are spread over 64 independently locked shards, each an array of bucket chains behind an
+/// atomic table pointer. Readers never lock: they walk immutable nodes under an EpochReclaimer
+/// guard and copy the value out. Writers lock only the key's shard and replace nodes instead of
+/// mutating them, so an update is a single pointer store. A shard that grows past one node per
+/// bucket is rebuilt into a table twice the size and swapped in while readers keep using the old
+/// one; other shards are unaffected.
+///
+/// @tparam V Value type; must be copy constructible (values are copied on read, update and resize)
+///
+/// @code
+/// ConcurrentUuidMap<EntityState> states;
+/// states.InsertOrAssign(id, EntityState{});
+///
+/// EntityState state;
+/// if (states.TryGet(id, state)) { ... }  // From any thread, without locking
+///
+/// states.Update(id, [](EntityState& s) { s.health -= 10; });
+/// @endcode
+template<typename V>
+class ConcurrentUuidMap {
+public:
+    static_assert(std::is_copy_constructible_v<V>, "ConcurrentUuidMap values must be copy constructible.");
+
+    // Enums
+
+    // Public Fields
+
+    /// @brief Number of independently locked shards
+    static constexpr size_t SHARD_COUNT = 64;
+
+    // Constructors and Destructors
+
+    /// @brief Creates an empty map
+    /// @param expectedSize Number of entries to size the initial tables for
+    explicit ConcurrentUuidMap(size_t expectedSize = 0)
+    {
+        size_t bucketCount = MIN_BUCKETS;
+        while (bucketCount * SHARD_COUNT < expectedSize) bucketCount *= 2;
+
+        for (Shard& shard : _shards)
+        {
+            shard.table.store(new Table(bucketCount), std::memory_order_relaxed);
+        }
+    }
+
+    /// @brief Destructor. Must not run concurrently with any other access.
+    ~ConcurrentUuidMap()
+    {
+        for (Shard& shard : _shards)
+        {
+            Table* table = shard.table.load(std::memory_order_acquire);
+            DeleteNodes(table);
+            delete table;
+        }
+    }
+
+    ConcurrentUuidMap(const ConcurrentUuidMap&) = delete;
+    ConcurrentUuidMap& operator=(const ConcurrentUuidMap&) = delete;
+
+    // Public Methods
+
+    /// @brief Copies the value stored for a key
+    /// @param key The key to look up
+    /// @param outValue Receives a copy of the value if found
+    /// @return true if the key was found
+    /// @note Lock-free
+    bool TryGet(const Uuid& key, V& outValue) const
+    {
+        EpochReclaimer::Guard guard;
+        const Node* node = FindNode(key);
+        if (node == nullptr) return false;
+
+        outValue = node->value;
+        return true;
+    }
+
+    /// @brief Copies the value stored for a key
+    /// @param key The key to look up
+    /// @return The value, or std::nullopt if the key is absent
+    /// @note Lock-free
+    std::optional<V> Get(const Uuid& key) const
+    {
+        EpochReclaimer::Guard guard;
+        const Node* node = FindNode(key);
+        if (node == nullptr) return std::nullopt;
+        return node->value;
+    }
+
+    /// @brief Checks whether a key is present
+    /// @param key The key to look up
+    /// @return true if the key was found
+    /// @note Lock-free
+    bool Contains(const Uuid& key) const
+    {
+        EpochReclaimer::Guard guard;
+        return FindNode(key) != nullptr;
+    }
+
+    /// @brief Adds an entry if the key is absent
+    /// @param key The key to add
+    /// @param value The value to store
+    /// @return true if added, false if the key was already present (the existing value is kept)
+    bool Insert(const Uuid& key, V value)
+    {
+        const uint64_t hash = Hash(key);
+        Shard& shard = ShardOf(hash);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+
+        std::atomic<Node*>* link = FindLink(shard, hash, key);
+        if (link->load(std::memory_order_relaxed) != nullptr) return false;
+
+        PushFront(shard, hash, new Node(key, std::move(value), nullptr));
+        return true;
+    }
+
+    /// @brief Adds an entry or replaces the value of an existing one
+    /// @param key The key to set
+    /// @param value The value to store
+    void InsertOrAssign(const Uuid& key, V value)
+    {
+        const uint64_t hash = Hash(key);
+        Shard& shard = ShardOf(hash);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+
+        std::atomic<Node*>* link = FindLink(shard, hash, key);
+        Node* existing = link->load(std::memory_order_relaxed);
+        if (existing == nullptr)
+        {
+            PushFront(shard, hash, new Node(key, std::move(value), nullptr));
+            return;
+        }
+
+        Replace(link, existing, std::move(value));
+    }
+
+    /// @brief Modifies the value of an existing entry
+    /// @param key The key to modify
+    /// @param func Called with a copy of the current value to modify; the copy then replaces it
+    /// @return true if the key was found
+    /// @note func runs while the key's shard is locked and must not access this map
+    template<typename Func>
+    bool Update(const Uuid& key, Func&& func)
+    {
+        const uint64_t hash = Hash(key);
+        Shard& shard = ShardOf(hash);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+
+        std::atomic<Node*>* link = FindLink(shard, hash, key);
+        Node* existing = link->load(std::memory_order_relaxed);
+        if (existing == nullptr) return false;
+
+        V value = existing->value;
+        func(value);
+        Replace(link, existing, std::move(value));
+        return true;
+    }
+
+    /// @brief Removes an entry
+    /// @param key The key to remove
+    /// @return true if the key was found and removed
+    bool Remove(const Uuid& key)
+    {
+        const uint64_t hash = Hash(key);
+        Shard& shard = ShardOf(hash);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+
+        std::atomic<Node*>* link = FindLink(shard, hash, key);
+        Node* existing = link->load(std::memory_order_relaxed);
+        if (existing == nullptr) return false;
+
+        link->store(existing->next.load(std::memory_order_relaxed), std::memory_order_release);
+        shard.size.fetch_sub(1, std::memory_order_relaxed);
+        EpochReclaimer::Retire(existing);
+        return true;
+    }
+
+    /// @brief Removes every entry
+    void Clear()
+    {
+        for (Shard& shard : _shards)
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            Table* old = shard.table.load(std::memory_order_relaxed);
+            shard.table.store(new Table(MIN_BUCKETS), std::memory_order_release);
+            shard.size.store(0, std::memory_order_relaxed);
+            RetireTable(old);
+        }
+    }
+
+    /// @brief Visits every entry
+    /// @param func Called as func(const Uuid&, const V&) for each entry
+    /// @note Lock-free and weakly consistent: concurrent changes may or may not be observed
+    template<typename Func>
+    void ForEach(Func&& func) const
+    {
+        EpochReclaimer::Guard guard;
+        for (const Shard& shard : _shards)
+        {
+            const Table* table = shard.table.load(std::memory_order_acquire);
+            for (size_t i = 0; i <= table->mask; ++i)
+            {
+                for (const Node* node = table->buckets[i].load(std::memory_order_acquire); node != nullptr;
+                     node = node->next.load(std::memory_order_acquire))
+                {
+                    func(node->key, node->value);
+                }
+            }
+        }
+    }
+
+    /// @brief Gets the number of entries
+    /// @return Entry count; approximate while writers are active
+    size_t Size() const
+    {
+        size_t size = 0;
+        for (const Shard& shard : _shards)
+        {
+            size += shard.size.load(std::memory_order_relaxed);
+        }
+        return size;
+    }
+
+    /// @brief Checks whether the map has no entries
+    /// @return true if Size() is zero
+    bool Empty() const { return Size() == 0; }
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    /// @brief Immutable entry; replaced rather than modified once published
+    struct Node {
+        Uuid key;
+        V value;
+        std::atomic<Node*> next;
+
+        Node(const Uuid& nodeKey, V nodeValue, Node* nextNode)
+            : key(nodeKey), value(std::move(nodeValue)), next(nextNode) {}
+    };
+
+    /// @brief Power-of-two array of bucket chains
+    struct Table {
+        size_t mask;
+        std::unique_ptr<std::atomic<Node*>[]> buckets;
+
+        explicit Table(size_t bucketCount)
+            : mask(bucketCount - 1), buckets(new std::atomic<Node*>[bucketCount])
+        {
+            for (size_t i = 0; i < bucketCount; ++i) buckets[i].store(nullptr, std::memory_order_relaxed);
+        }
+    };
+
+    struct alignas(64) Shard {
+        std::atomic<Table*> table{nullptr};
+        std::atomic<size_t> size{0};
+        std::mutex mutex;
+    };
+
+    static constexpr size_t MIN_BUCKETS = 8;
+    static constexpr int SHARD_SHIFT = 58; // Top 6 hash bits select one of 64 shards
+
+    // Private Fields
+
+    Shard _shards[SHARD_COUNT];
+
+    // Private Methods
+
+    /// @brief Mixes both key halves so sequential and random UUIDs both spread over shards and buckets
+    static uint64_t Hash(const Uuid& key)
+    {
+        uint64_t halves[2];
+        std::memcpy(halves, reinterpret_cast<const unsigned char*>(&key), sizeof(halves));
+        uint64_t hash = (halves[0] * 0x9E3779B97F4A7C15ull) ^ halves[1];
+        hash *= 0xD6E8FEB86659FD93ull;
+        return hash ^ (hash >> 32);
+    }
+
+    Shard& ShardOf(uint64_t hash) { return _shards[hash >> SHARD_SHIFT]; }
+    const Shard& ShardOf(uint64_t hash) const { return _shards[hash >> SHARD_SHIFT]; }
+
+    const Node* FindNode(const Uuid& key) const
+    {
+        const uint64_t hash = Hash(key);
+        const Table* table = ShardOf(hash).table.load(std::memory_order_acquire);
+        for (const Node* node = table->buckets[hash & table->mask].load(std::memory_order_acquire); node != nullptr;
+             node = node->next.load(std::memory_order_acquire))
+        {
+            if (node->key == key) return node;
+        }
+        return nullptr;
+    }
+
+    /// @brief Finds the link pointing at the key's node, or the null link ending its chain (shard locked)
+    static std::atomic<Node*>* FindLink(Shard& shard, uint64_t hash, const Uuid& key)
+    {
+        Table* table = shard.table.load(std::memory_order_relaxed);
+        std::atomic<Node*>* link = &table->buckets[hash & table->mask];
+        for (Node* node = link->load(std::memory_order_relaxed); node != nullptr; node = link->load(std::memory_order_relaxed))
+        {
+            if (node->key == key) break;
+            link = &node->next;
+        }
+        return link;
+    }
+
+    /// @brief Publishes a new node at the head of its bucket and grows the shard if needed (shard locked)
+    static void PushFront(Shard& shard, uint64_t hash, Node* node)
+    {
+        Table* table = shard.table.load(std::memory_order_relaxed);
+        std::atomic<Node*>& bucket = table->buckets[hash & table->mask];
+        node->next.store(bucket.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        bucket.store(node, std::memory_order_release);
+
+        const size_t size = shard.size.fetch_add(1, std::memory_order_relaxed) + 1;
+        if (size > table->mask + 1) Grow(shard, table);
+    }
+
+    /// @brief Swaps a node for a copy holding a new value (shard locked)
+    static void Replace(std::atomic<Node*>* link, Node* existing, V value)
+    {
+        Node* replacement = new Node(existing->key, std::move(value), existing->next.load(std::memory_order_relaxed));
+        link->store(replacement, std::memory_order_release);
+        EpochReclaimer::Retire(existing);
+    }
+
+    /// @brief Rebuilds a shard's table at twice the size; readers keep using the old table meanwhile (shard locked)
+    static void Grow(Shard& shard, Table* old)
+    {
+        Table* table = new Table((old->mask + 1) * 2);
+        for (size_t i = 0; i <= old->mask; ++i)
+        {
+            for (Node* node = old->buckets[i].load(std::memory_order_relaxed); node != nullptr;
+                 node = node->next.load(std::memory_order_relaxed))
+            {
+                std::atomic<Node*>& bucket = table->buckets[Hash(node->key) & table->mask];
+                bucket.store(new Node(node->key, node->value, bucket.load(std::memory_order_relaxed)), std::memory_order_relaxed);
+            }
+        }
+
+        shard.table.store(table, std::memory_order_release);
+        RetireTable(old);
+    }
+
+    /// @brief Retires a table that is no longer published, along with all of its nodes
+    static void RetireTable(Table* table)
+    {
+        EpochReclaimer::Retire(table, [](void* object) {
+            Table* retired = static_cast<Table*>(object);
+            DeleteNodes(retired);
+            delete retired;
+        });
+    }
+
+    static void DeleteNodes(Table* table)
+    {
+        for (size_t i = 0; i <= table->mask; ++i)
+        {
+            Node* node = table->buckets[i].load(std::memory_order_relaxed);
+            while (node != nullptr)
+            {
+                Node* next = node->next.load(std::memory_order_relaxed);
+                delete node;
+                node = next;
+            }
+        }
+    }
+};
+
+} // namespace velecs::common
@@ -0,0 +1,158 @@
+/// @file    CoroutineScheduler.hpp
+/// @author  Matthew Green
+/// @date    2026-10-18 21:15:03
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/common/Task.hpp"
+
+#if VELECS_HAS_COROUTINES
+
+#include "velecs/common/ThreadExecutor.hpp"
+
+#include <condition_variable>
+#include <coroutine>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace velecs::common {
+
+/// @class CoroutineScheduler
+/// @brief Worker thread pool that coroutines hop onto with co_await Schedule().
+///
+/// Pair it with ResumeOn(ThreadExecutor&) to come back to the main thread, so a load can read and
+/// decode on workers and publish its result on the thread that owns the scene.
+///
+/// @code
+/// CoroutineScheduler scheduler;
+/// ThreadExecutor mainThread;
+///
+/// Task<> LoadLevel(CoroutineScheduler& scheduler, ThreadExecutor& mainThread)
+/// {
+///     std::vector<Task<std::vector<uint8_t>>> reads;
+///     for (const auto& file : levelFiles) reads.push_back(ReadAssetAsync(scheduler, file));
+///     std::vector<std::vector<uint8_t>> blobs = co_await WhenAll(std::move(reads));
+///
+///     co_await ResumeOn(mainThread);
+///     Publish(blobs);
+/// }
+/// @endcode
+class CoroutineScheduler {
+public:
+    // Enums
+
+    // Public Fields
+
+    /// @brief Awaiter returned by Schedule(); resumes the awaiting coroutine on a worker
+    struct ScheduleAwaiter {
+        CoroutineScheduler& scheduler;
+
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(std::coroutine_handle<> handle) { scheduler.Post(handle); }
+        void await_resume() const noexcept {}
+    };
+
+    // Constructors and Destructors
+
+    /// @brief Starts the worker threads
+    /// @param threadCount Number of workers; 0 uses one per hardware thread
+    explicit CoroutineScheduler(size_t threadCount = 0);
+
+    /// @brief Destructor. Runs everything already queued, then joins the workers.
+    ~CoroutineScheduler();
+
+    CoroutineScheduler(const CoroutineScheduler&) = delete;
+    CoroutineScheduler& operator=(const CoroutineScheduler&) = delete;
+
+    // Public Methods
+
+    /// @brief Moves the awaiting coroutine onto a worker thread
+    ScheduleAwaiter Schedule() noexcept { return ScheduleAwaiter{*this}; }
+
+    /// @brief Queues a coroutine to be resumed on a worker thread
+    void Post(std::coroutine_handle<> handle);
+
+    /// @brief Gets the number of worker threads
+    size_t ThreadCount() const { return _workers.size(); }
+
+    /// @brief Checks whether the calling thread is one of this scheduler's workers
+    bool IsWorkerThread() const;
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    std::deque<std::coroutine_handle<>> _queue;
+    bool _stopping{false};
+    std::vector<std::thread> _workers;
+
+    // Private Methods
+
+    void WorkerLoop();
+};
+
+/// @brief Awaiter returned by ResumeOn()
+class ResumeOnAwaiter {
+public:
+    explicit ResumeOnAwaiter(ThreadExecutor& executor) noexcept : _executor(executor) {}
+
+    /// @brief Already on the owning thread: continue without a round trip through the inbox
+    bool await_ready() const noexcept { return _executor.IsOwnerThread(); }
+
+    void await_suspend(std::coroutine_handle<> handle) { _executor.Post(std::make_unique<ResumeTask>(handle)); }
+
+    void await_resume() const noexcept {}
+
+private:
+    class ResumeTask final : public ThreadExecutor::Task {
+    public:
+        explicit ResumeTask(std::coroutine_handle<> handle) noexcept : _handle(handle) {}
+        void Run() override { _handle.resume(); }
+
+    private:
+        std::coroutine_handle<> _handle;
+    };
+
+    ThreadExecutor& _executor;
+};
+
+/// @brief Moves the awaiting coroutine to the thread that drains an executor, e.g. the main thread
+/// @param executor Executor whose owning thread resumes the coroutine on its next Drain()
+/// @note If the executor is destroyed with the coroutine still queued, the coroutine never resumes
+inline ResumeOnAwaiter ResumeOn(ThreadExecutor& executor) noexcept { return ResumeOnAwaiter(executor); }
+
+/// @brief Reads a whole file on a scheduler worker
+/// @param scheduler Scheduler whose worker performs the read
+/// @param path File to read
+/// @return The file's bytes; the awaiting coroutine continues on the worker
+/// @throws std::runtime_error if the file cannot be read
+/// @note Reports the access to StartupReadahead so startup profiles include coroutine loads
+Task<std::vector<uint8_t>> ReadFileAsync(CoroutineScheduler& scheduler, std::filesystem::path path);
+
+/// @brief Reads a whole file under Paths::AssetsDir() on a scheduler worker
+/// @param scheduler Scheduler whose worker performs the read
+/// @param relativePath Path relative to the assets directory
+/// @return The file's bytes; the awaiting coroutine continues on the worker
+/// @throws std::runtime_error if Paths is not initialized or the file cannot be read
+Task<std::vector<uint8_t>> ReadAssetAsync(CoroutineScheduler& scheduler, std::filesystem::path relativePath);
+
+} // namespace velecs::common
+
+#endif // VELECS_HAS_COROUTINES
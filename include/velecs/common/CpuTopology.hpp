@@ -0,0 +1,193 @@
+/// @file    CpuTopology.hpp
+/// @author  Matthew Green
+/// @date    2026-10-18 20:41:57
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace velecs::common {
+
+/// @class CpuTopology
+/// @brief Model of the machine's packages, cores, SMT siblings, shared caches and NUMA nodes, plus
+/// thread pinning and NUMA-local allocation helpers.
+///
+/// On Linux the model is read from /sys/devices/system/cpu and /sys/devices/system/node. Elsewhere,
+/// or if /sys is unreadable, it falls back to one package and one NUMA node with one core per
+/// hardware thread and no cache information. Thread pools can use PreferredOrder() to spread
+/// workers over physical cores before SMT siblings, and CpusSharingL2/L3() to keep cooperating
+/// threads on a shared cache.
+///
+/// @code
+/// const CpuTopology& topology = CpuTopology::Get();
+/// std::vector<uint32_t> order = topology.PreferredOrder();
+/// for (size_t i = 0; i < workers.size(); ++i)
+/// {
+///     workers[i] = std::thread([cpu = order[i % order.size()]] {
+///         CpuTopology::PinCurrentThread(cpu);
+///         ...
+///     });
+/// }
+///
+/// void* buffer = CpuTopology::AllocateOnNode(bytes, topology.Cpu(cpu).numaNode);
+/// CpuTopology::FreeOnNode(buffer, bytes);
+/// @endcode
+class CpuTopology {
+public:
+    // Enums
+
+    // Public Fields
+
+    /// @brief Value of cache group fields when the cache level was not reported
+    static constexpr uint32_t NO_GROUP = UINT32_MAX;
+
+    /// @brief One online hardware thread
+    struct LogicalCpu {
+        uint32_t id{0};            ///< OS CPU number, as used by affinity masks
+        uint32_t package{0};       ///< Dense package (socket) index
+        uint32_t core{0};          ///< Dense physical core index, unique across packages
+        uint32_t numaNode{0};      ///< NUMA node id as used by the OS
+        uint32_t l2Group{NO_GROUP}; ///< Dense index of the L2 cache this CPU uses
+        uint32_t l3Group{NO_GROUP}; ///< Dense index of the L3 cache this CPU uses
+    };
+
+    // Constructors and Destructors
+
+    /// @brief Default constructor. Creates an empty model; use Get() or Detect().
+    CpuTopology() = default;
+
+    /// @brief Default deconstructor.
+    ~CpuTopology() = default;
+
+    // Public Methods
+
+    /// @brief Gets the topology of this machine, detected on first call
+    static const CpuTopology& Get();
+
+    /// @brief Builds a topology from a sysfs tree
+    /// @param sysRoot Directory containing cpu/ and node/, normally /sys/devices/system
+    /// @return The parsed model, or the fallback model if sysRoot/cpu/online cannot be read
+    static CpuTopology Detect(const std::filesystem::path& sysRoot = "/sys/devices/system");
+
+    /// @brief Gets every online CPU, ordered by id
+    const std::vector<LogicalCpu>& Cpus() const { return _cpus; }
+
+    /// @brief Gets a CPU by OS id
+    /// @throws std::out_of_range if the CPU is not online
+    const LogicalCpu& Cpu(uint32_t id) const;
+
+    /// @brief Gets the number of online hardware threads
+    size_t LogicalCpuCount() const { return _cpus.size(); }
+
+    /// @brief Gets the number of physical cores
+    size_t CoreCount() const { return _coreCount; }
+
+    /// @brief Gets the number of packages (sockets)
+    size_t PackageCount() const { return _packageCount; }
+
+    /// @brief Gets the ids of the NUMA nodes that have CPUs
+    const std::vector<uint32_t>& NumaNodes() const { return _numaNodes; }
+
+    /// @brief Gets the CPUs of a physical core (the core's SMT siblings)
+    std::vector<uint32_t> CpusOfCore(uint32_t core) const;
+
+    /// @brief Gets the CPUs in a package
+    std::vector<uint32_t> CpusInPackage(uint32_t package) const;
+
+    /// @brief Gets the CPUs in a NUMA node
+    std::vector<uint32_t> CpusInNumaNode(uint32_t node) const;
+
+    /// @brief Gets the CPUs sharing a CPU's L2 cache, including itself
+    std::vector<uint32_t> CpusSharingL2(uint32_t cpu) const;
+
+    /// @brief Gets the CPUs sharing a CPU's L3 cache, including itself
+    std::vector<uint32_t> CpusSharingL3(uint32_t cpu) const;
+
+    /// @brief Orders CPUs for placing workers: the first thread of every core, grouped by NUMA node
+    ///        and L3, then the remaining SMT siblings in the same order
+    std::vector<uint32_t> PreferredOrder() const;
+
+    /// @brief Restricts the calling thread to one CPU
+    /// @return true on success; false if unsupported or the OS refused
+    static bool PinCurrentThread(uint32_t cpu);
+
+    /// @brief Restricts the calling thread to a set of CPUs
+    /// @return true on success; false if unsupported or the OS refused
+    static bool PinCurrentThread(const std::vector<uint32_t>& cpus);
+
+    /// @brief Gets the CPUs the calling thread may run on
+    /// @return The affinity set, or an empty vector if unsupported
+    static std::vector<uint32_t> CurrentAffinity();
+
+    /// @brief Gets the CPU the calling thread is running on right now
+    /// @return The CPU id, or UINT32_MAX if unsupported
+    static uint32_t CurrentCpu();
+
+    /// @brief Allocates page-aligned memory backed by a NUMA node
+    /// @param size Bytes to allocate
+    /// @param node NUMA node id
+    /// @return The memory, or nullptr on failure. Falls back to unbound memory where NUMA binding
+    ///         is unsupported. Release with FreeOnNode().
+    static void* AllocateOnNode(size_t size, uint32_t node);
+
+    /// @brief Releases memory from AllocateOnNode()
+    /// @param memory The pointer returned by AllocateOnNode(); nullptr is ignored
+    /// @param size The size passed to AllocateOnNode()
+    static void FreeOnNode(void* memory, size_t size);
+
+    /// @brief Binds existing pages to a NUMA node (mbind MPOL_BIND)
+    /// @param memory Page-aligned start address
+    /// @param size Bytes to bind
+    /// @param node NUMA node id
+    /// @return true on success; false if unsupported or the kernel refused
+    static bool BindMemoryToNode(void* memory, size_t size, uint32_t node);
+
+    /// @brief Makes the calling thread's future allocations prefer a NUMA node (set_mempolicy MPOL_PREFERRED)
+    /// @return true on success; false if unsupported or the kernel refused
+    static bool PreferNodeForCurrentThread(uint32_t node);
+
+    /// @brief Parses a kernel CPU list such as "0-3,8,10-11"
+    /// @return Sorted, unique CPU ids; malformed or reversed entries and ids above 65535 are skipped
+    static std::vector<uint32_t> ParseCpuList(const std::string& list);
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    std::vector<LogicalCpu> _cpus;
+    std::vector<uint32_t> _numaNodes;
+    size_t _coreCount{0};
+    size_t _packageCount{0};
+
+    // Private Methods
+
+    /// @brief One package, one node, one core per hardware thread
+    static CpuTopology Fallback();
+
+    template<typename Predicate>
+    std::vector<uint32_t> Select(Predicate&& predicate) const
+    {
+        std::vector<uint32_t> ids;
+        for (const LogicalCpu& cpu : _cpus)
+        {
+            if (predicate(cpu)) ids.push_back(cpu.id);
+        }
+        return ids;
+    }
+};
+
+} // namespace velecs::common
@@ -0,0 +1,160 @@
+/// @file    DirtyTracker.hpp
+/// @author  Matthew Green
+/// @date    2026-10-18 19:10:52
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/common/BitfieldEnum.hpp"
+#include "velecs/common/HierarchicalBitset.hpp"
+
+#include <array>
+#include <cstdint>
+#include <type_traits>
+
+namespace velecs::common {
+
+/// @class DirtyTracker
+/// @brief Tracks which object ids have which dirty flags, so per-frame systems visit only changed objects.
+///
+/// Keeps one HierarchicalBitset per flag bit of E. Marking is O(1) per flag; visiting and clearing
+/// a category costs O(dirty objects) rather than O(all objects).
+///
+/// @tparam E Enum type with EnableBitfieldEnum specialized
+///
+/// @code
+/// DirtyTracker<ChangeFlags> dirty;
+/// dirty.Mark(id, ChangeFlags::Transform);
+///
+/// dirty.ForEach(ChangeFlags::Transform | ChangeFlags::Bounds, [](uint32_t id) { Refit(id); });
+/// dirty.Clear(ChangeFlags::Transform | ChangeFlags::Bounds);
+/// @endcode
+template<typename E>
+class DirtyTracker {
+    static_assert(is_bitfield_enum_v<E>, "DirtyTracker requires an enum with EnableBitfieldEnum specialized");
+
+    using Underlying = std::make_unsigned_t<std::underlying_type_t<E>>;
+
+public:
+    // Enums
+
+    // Public Fields
+
+    /// @brief Number of flag bits in E
+    static constexpr unsigned BIT_COUNT = sizeof(Underlying) * 8;
+
+    // Constructors and Destructors
+
+    /// @brief Default constructor. Nothing is dirty.
+    DirtyTracker() = default;
+
+    /// @brief Default deconstructor.
+    ~DirtyTracker() = default;
+
+    // Public Methods
+
+    /// @brief Marks flags dirty on an object
+    void Mark(uint32_t id, E flags)
+    {
+        ForEachSetBit(static_cast<Underlying>(flags), 0, [&](uint64_t bit) { _bits[bit].Set(id); });
+    }
+
+    /// @brief Clears flags on one object
+    void Unmark(uint32_t id, E flags)
+    {
+        ForEachSetBit(static_cast<Underlying>(flags), 0, [&](uint64_t bit) { _bits[bit].Reset(id); });
+    }
+
+    /// @brief Gets the dirty flags of an object
+    E Get(uint32_t id) const
+    {
+        Underlying flags = 0;
+        for (unsigned bit = 0; bit < BIT_COUNT; ++bit)
+        {
+            if (_bits[bit].Test(id)) flags |= Underlying{1} << bit;
+        }
+        return static_cast<E>(flags);
+    }
+
+    /// @brief Checks whether an object has any of the given flags dirty
+    bool IsDirty(uint32_t id, E flags) const
+    {
+        bool dirty = false;
+        ForEachSetBit(static_cast<Underlying>(flags), 0, [&](uint64_t bit) { dirty = dirty || _bits[bit].Test(id); });
+        return dirty;
+    }
+
+    /// @brief Calls a function once per object with any of the given flags dirty, in ascending id order
+    /// @param flags Categories to visit
+    /// @param func Callable taking a uint32_t id
+    template<typename Func>
+    void ForEach(E flags, Func&& func) const
+    {
+        // Gather the categories once, then merge them word by word so shared ids are visited once
+        const HierarchicalBitset* sets[BIT_COUNT];
+        unsigned setCount = 0;
+        size_t summaryWords = 0;
+        ForEachSetBit(static_cast<Underlying>(flags), 0, [&](uint64_t bit) {
+            sets[setCount++] = &_bits[bit];
+            if (_bits[bit].SummaryWordCount() > summaryWords) summaryWords = _bits[bit].SummaryWordCount();
+        });
+
+        if (setCount == 1)
+        {
+            sets[0]->ForEach(func);
+            return;
+        }
+
+        for (size_t s = 0; s < summaryWords; ++s)
+        {
+            uint64_t summary = 0;
+            for (unsigned i = 0; i < setCount; ++i) summary |= sets[i]->SummaryWord(s);
+
+            ForEachSetBit(summary, s * 64, [&](uint64_t word) {
+                uint64_t bits = 0;
+                for (unsigned i = 0; i < setCount; ++i) bits |= sets[i]->Word(word);
+                ForEachSetBit(bits, word * 64, [&func](uint64_t id) { func(static_cast<uint32_t>(id)); });
+            });
+        }
+    }
+
+    /// @brief Counts the objects with a single flag dirty
+    /// @param flag One flag; if several are given, the lowest one is counted
+    size_t Count(E flag) const
+    {
+        Underlying bits = static_cast<Underlying>(flag);
+        return bits == 0 ? 0 : _bits[CountTrailingZeros(bits)].Count();
+    }
+
+    /// @brief Clears the given flags on every object, touching only dirty words
+    void Clear(E flags)
+    {
+        ForEachSetBit(static_cast<Underlying>(flags), 0, [&](uint64_t bit) { _bits[bit].Clear(); });
+    }
+
+    /// @brief Clears every flag on every object
+    void ClearAll()
+    {
+        for (auto& bits : _bits) bits.Clear();
+    }
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    /// @brief Dirty objects per flag bit
+    std::array<HierarchicalBitset, BIT_COUNT> _bits;
+
+    // Private Methods
+};
+
+} // namespace velecs::common
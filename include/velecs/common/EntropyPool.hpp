@@ -0,0 +1,90 @@
+/// @file    EntropyPool.hpp
+/// @author  Matthew Green
+/// @date    2026-10-18 16:08:51
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace velecs::common {
+
+/// @class EntropyPool
+/// @brief Process-wide buffer of operating-system entropy, read in large blocks.
+///
+/// Seeding a generator from std::random_device costs one system call per value on most
+/// platforms. The pool instead reads a whole block with a single getrandom() call and hands out
+/// never-reused slices of it, so seeding a new thread's generator is a memcpy. Used by
+/// Uuid::GenerateRandom() to seed its per-thread engines.
+///
+/// A child created by fork() discards the buffered bytes it inherited, so parent and child never
+/// hand out the same entropy; generators seeded from the pool check Generation() to reseed too.
+///
+/// @code
+/// // At startup, before spawning 64 workers that generate UUIDs
+/// EntropyPool::Reserve(64 * EntropyPool::SEED_BYTES);
+///
+/// // In each worker, optionally, to keep the seeding cost off the first GenerateRandom() call
+/// Uuid::SeedCurrentThread();
+/// @endcode
+class EntropyPool {
+public:
+    // Enums
+
+    // Public Fields
+
+    /// @brief Bytes consumed to seed one thread's UUID generator (a full Mersenne Twister state)
+    static constexpr size_t SEED_BYTES = 624 * sizeof(uint32_t);
+
+    /// @brief Bytes read from the operating system per refill
+    static constexpr size_t BLOCK_BYTES = 64 * 1024;
+
+    // Constructors and Destructors
+
+    /// @brief Default constructor.
+    EntropyPool() = default;
+
+    /// @brief Default deconstructor.
+    ~EntropyPool() = default;
+
+    // Public Methods
+
+    /// @brief Fills a buffer with random bytes that are handed out only once
+    /// @param out Destination buffer
+    /// @param size Number of bytes to write
+    /// @throws std::runtime_error if the operating system fails to provide entropy
+    /// @note Thread-safe. Only refills from the operating system when the pool runs dry.
+    static void Fill(void* out, size_t size);
+
+    /// @brief Ensures at least the given number of bytes can be served without a system call
+    /// @param size Number of bytes to have available, e.g. threadCount * SEED_BYTES
+    /// @throws std::runtime_error if the operating system fails to provide entropy
+    static void Reserve(size_t size);
+
+    /// @brief Gets the number of bytes currently available without a system call
+    /// @return Bytes remaining in the pool
+    static size_t Available();
+
+    /// @brief Gets a value that changes whenever the process forks and the pool discards its bytes
+    /// @note One relaxed load. Generators seeded from the pool compare it to the value they were
+    ///       seeded under and reseed on a mismatch, so a forked child does not repeat its parent.
+    static uint64_t Generation();
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    // Private Methods
+};
+
+} // namespace velecs::common
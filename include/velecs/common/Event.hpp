@@ -10,13 +10,22 @@
 
 #pragma once
 
+#include "velecs/common/Metrics.hpp"
+#include "velecs/common/ThreadExecutor.hpp"
+
 #include <vector>
 #include <functional>
 #include <algorithm>
 #include <atomic>
+#include <cstdint>
+#include <memory>
+#include <tuple>
+#include <type_traits>
 
 namespace velecs::common {
 
+class EventRecorder;
+
 /// @class Event
 /// @brief A lightweight event system that allows multiple callbacks to be registered and invoked together.
 ///
@@ -41,6 +50,9 @@ namespace velecs::common {
 /// // Trigger events
 /// buttonClicked();           // Calls all registered callbacks
 /// valueChanged(42, 3.14f);   // Calls all callbacks with parameters
+///
+/// // Run a callback on the render thread regardless of which thread invokes the event
+/// valueChanged.Add([](int id, float value) { Redraw(id, value); }, renderInbox);
 /// @endcode
 template<typename... Args>
 class Event {
@@ -56,6 +68,37 @@ private:
     struct CallbackEntry {
         Handle handle;
         Callback callback;
+
+        /// @brief Cleared by Remove() so batches already queued skip the callback (thread-affine entries only)
+        std::shared_ptr<std::atomic<bool>> alive;
+    };
+
+    /// @brief Immutable list of callbacks shared with batches already queued on an executor
+    using CallbackList = std::shared_ptr<const std::vector<CallbackEntry>>;
+
+    /// @brief Callbacks that must run on a specific executor's thread
+    struct AffineGroup {
+        ThreadExecutor* executor;
+        CallbackList callbacks;
+    };
+
+    /// @brief One Invoke's worth of work for one executor: the argument values and callback snapshot
+    class InvokeBatch final : public ThreadExecutor::Task {
+    public:
+        InvokeBatch(CallbackList callbacks, const Args&... args)
+            : _callbacks(std::move(callbacks)), _args(args...) {}
+
+        void Run() override
+        {
+            for (const auto& entry : *_callbacks)
+            {
+                if (entry.alive->load(std::memory_order_acquire)) std::apply(entry.callback, _args);
+            }
+        }
+
+    private:
+        CallbackList _callbacks;
+        std::tuple<std::decay_t<Args>...> _args;
     };
 
 public:
@@ -80,9 +123,39 @@ public:
     /// @note Handle generation is thread-safe using atomic operations
     Handle Add(const Callback& callback)
     {
-        static std::atomic<size_t> globalHandleCounter{1};
-        Handle handle = globalHandleCounter.fetch_add(1);
-        _callbacks.push_back({handle, callback});
+        Handle handle = NextHandle();
+        _callbacks.push_back({handle, callback, nullptr});
+        return handle;
+    }
+
+    /// @brief Adds a callback function that always runs on the thread owning an executor
+    /// @param callback The function to be called when this event is invoked
+    /// @param executor Executor whose owning thread runs the callback; must outlive the subscription
+    /// @return Handle that can be used to remove this specific callback later
+    /// @note Invoking from another thread queues one batch per executor holding copies of the arguments;
+    ///       the callbacks run when that executor is drained. Invoking from the owning thread runs them inline.
+    /// @note Thread-affine callbacks run after the callbacks added without an executor
+    /// @note Queued batches hold copies of the arguments, so events with non-const reference parameters
+    ///       cannot have thread-affine callbacks
+    Handle Add(const Callback& callback, ThreadExecutor& executor)
+    {
+        static_assert(!(... || (std::is_lvalue_reference_v<Args> && !std::is_const_v<std::remove_reference_t<Args>>)),
+            "Thread-affine callbacks receive copies of the arguments; a non-const reference parameter would modify the copy.");
+
+        Handle handle = NextHandle();
+
+        auto group = std::find_if(_affineGroups.begin(), _affineGroups.end(),
+            [&executor](const AffineGroup& g) { return g.executor == &executor; });
+        if (group == _affineGroups.end())
+        {
+            _affineGroups.push_back({&executor, std::make_shared<const std::vector<CallbackEntry>>()});
+            group = std::prev(_affineGroups.end());
+        }
+
+        // Copy on write: batches already queued keep the list they were invoked with
+        auto callbacks = std::make_shared<std::vector<CallbackEntry>>(*group->callbacks);
+        callbacks->push_back({handle, callback, std::make_shared<std::atomic<bool>>(true)});
+        group->callbacks = std::move(callbacks);
         return handle;
     }
 
@@ -99,6 +172,9 @@ public:
     /// @param handle The handle returned when the callback was originally added
     /// @return Reference to this Event for method chaining
     /// @note If the handle is not found, this method has no effect
+    /// @note A removed thread-affine callback is skipped by batches already queued, so its owner may be destroyed
+    ///       right after Remove(). If the executor's thread is draining at that moment, a call already in
+    ///       progress still finishes.
     Event& Remove(Handle handle)
     {
         _callbacks.erase(
@@ -108,6 +184,23 @@ public:
                 }),
             _callbacks.end()
         );
+
+        for (auto& group : _affineGroups)
+        {
+            auto it = std::find_if(group.callbacks->begin(), group.callbacks->end(),
+                [handle](const CallbackEntry& entry) { return entry.handle == handle; });
+            if (it == group.callbacks->end()) continue;
+
+            it->alive->store(false, std::memory_order_release);
+            auto callbacks = std::make_shared<std::vector<CallbackEntry>>(*group.callbacks);
+            callbacks->erase(callbacks->begin() + (it - group.callbacks->begin()));
+            group.callbacks = std::move(callbacks);
+        }
+        _affineGroups.erase(
+            std::remove_if(_affineGroups.begin(), _affineGroups.end(),
+                [](const AffineGroup& group) { return group.callbacks->empty(); }),
+            _affineGroups.end()
+        );
         return *this;
     }
 
@@ -123,21 +216,52 @@ public:
     /// @brief Removes all registered callback functions from this event
     /// @note After calling this method, invoking the event will have no effect until new callbacks are added
     /// @note Handle counter is not reset to ensure uniqueness across all Event instances
+    /// @note Batches already queued on executors skip the removed callbacks, as with Remove()
     void Clear()
     {
         _callbacks.clear();
+        for (const auto& group : _affineGroups)
+        {
+            for (const auto& entry : *group.callbacks)
+            {
+                entry.alive->store(false, std::memory_order_release);
+            }
+        }
+        _affineGroups.clear();
     }
     
     /// @brief Invokes all registered callback functions with the provided arguments
     /// @param args Arguments to pass to each registered callback function
     /// @note Callbacks are called in the order they were registered. If a callback throws an exception,
     ///       subsequent callbacks will not be executed.
+    /// @note Thread-affine callbacks are queued to their executors, one batch per executor
+    /// @note An event attached to EventRecorder is recorded before any callback runs
     void Invoke(Args... args) const
     {
+        if (Metrics::IsEnabled()) InvokeCounter().Add();
+
+        if (_recordHook != nullptr) _recordHook(_recordStream, args...);
+
         for (const auto& entry : _callbacks)
         {
             entry.callback(args...);
         }
+
+        for (const auto& group : _affineGroups)
+        {
+            if (group.executor->IsOwnerThread())
+            {
+                CallbackList callbacks = group.callbacks;
+                for (const auto& entry : *callbacks)
+                {
+                    entry.callback(args...);
+                }
+            }
+            else
+            {
+                group.executor->Post(std::make_unique<InvokeBatch>(group.callbacks, args...));
+            }
+        }
     }
     
     /// @brief Invokes all registered callback functions using function call operator
@@ -147,19 +271,56 @@ public:
 
     /// @brief Checks if this event has no registered callbacks
     /// @return true if no callbacks are registered, false otherwise
-    bool Empty() const { return _callbacks.empty(); }
+    bool Empty() const { return _callbacks.empty() && _affineGroups.empty(); }
 
     /// @brief Gets the number of registered callbacks
     /// @return The number of callback functions currently registered with this event
-    size_t Size() const { return _callbacks.size(); }
+    size_t Size() const
+    {
+        size_t size = _callbacks.size();
+        for (const auto& group : _affineGroups)
+        {
+            size += group.callbacks->size();
+        }
+        return size;
+    }
 
 private:
+    friend class EventRecorder;
+
+    /// @brief Records one invoke of the event into the active recording session
+    using RecordHook = void (*)(uint32_t, const std::decay_t<Args>&...);
+
     // Private Fields
 
+    /// @brief Set by EventRecorder::Attach(); called directly from Invoke() so recording costs no listener call
+    RecordHook _recordHook{nullptr};
+
+    /// @brief Stream identifier passed to _recordHook
+    uint32_t _recordStream{0};
+
     /// @brief Container storing all registered callback functions with their handles
     std::vector<CallbackEntry> _callbacks;
 
+    /// @brief Thread-affine callbacks grouped by the executor that runs them
+    std::vector<AffineGroup> _affineGroups;
+
     // Private Methods
+
+    /// @brief Generates a handle unique across all Event instances of this signature
+    /// @note Handle generation is thread-safe using atomic operations
+    static Handle NextHandle()
+    {
+        static std::atomic<size_t> globalHandleCounter{1};
+        return globalHandleCounter.fetch_add(1);
+    }
+
+    /// @brief Counts Invoke() calls across all events
+    static Counter& InvokeCounter()
+    {
+        static Counter& counter = Metrics::GetCounter("event.invokes");
+        return counter;
+    }
 };
 
 } // namespace velecs::common
\ No newline at end of file
@@ -0,0 +1,359 @@
+/// @file    EventRecorder.hpp
+/// @author  Matthew Green
+/// @date    2026-10-18 10:18:52
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/common/Event.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <atomic>
+#include <string>
+#include <vector>
+#include <tuple>
+#include <functional>
+#include <unordered_map>
+#include <filesystem>
+#include <chrono>
+#include <stdexcept>
+#include <type_traits>
+
+namespace velecs::common {
+
+class EventRecorder;
+
+/// @class EventRecordWriter
+/// @brief Appends the payload of one record to the invoking thread's recording buffer.
+///
+/// Created by EventRecorder for every recorded invoke and handed to each argument's
+/// EventPayloadSerializer. Writes are a bounds check plus memcpy into a preallocated buffer;
+/// the record is discarded unless it is committed.
+class EventRecordWriter {
+public:
+    EventRecordWriter(const EventRecordWriter&) = delete;
+    EventRecordWriter& operator=(const EventRecordWriter&) = delete;
+
+    /// @brief Destructor. Publishes the record if committed, discards it otherwise.
+    ~EventRecordWriter();
+
+    /// @brief Appends raw bytes to the record payload
+    /// @param data Bytes to append
+    /// @param size Number of bytes to append
+    void WriteBytes(const void* data, size_t size)
+    {
+        if (static_cast<size_t>(_end - _cursor) < size) MakeRoom(size);
+        std::memcpy(_cursor, data, size);
+        _cursor += size;
+    }
+
+    /// @brief Appends the object representation of a trivially copyable value
+    /// @tparam T Trivially copyable type
+    /// @param value Value to append
+    template<typename T>
+    void WriteValue(const T& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "WriteValue requires a trivially copyable type.");
+        WriteBytes(&value, sizeof(T));
+    }
+
+private:
+    friend class EventRecorder;
+
+    void* _log;
+    uint8_t* _recordStart;
+    uint8_t* _cursor;
+    uint8_t* _end;
+    bool _committed{false};
+
+    /// @brief Locks the calling thread's buffer and writes the record header
+    /// @param streamId Stream identifier of the record
+    explicit EventRecordWriter(uint32_t streamId);
+
+    /// @brief Marks the payload as complete
+    void Commit() { _committed = true; }
+
+    /// @brief Flushes completed records or grows the buffer so size more bytes fit
+    /// @param size Number of bytes about to be written
+    void MakeRoom(size_t size);
+};
+
+/// @struct EventPayloadSerializer
+/// @brief Converts one event argument to and from the binary recording format.
+///
+/// The primary template handles trivially copyable types by copying their bytes. Specialize it
+/// for any other argument type that should be recordable.
+///
+/// @tparam T Decayed argument type
+///
+/// @code
+/// template<> struct EventPayloadSerializer<PlayerState> {
+///     static void Write(EventRecordWriter& out, const PlayerState& value) { /* out.WriteBytes(...) */ }
+///     static PlayerState Read(const uint8_t*& cursor, const uint8_t* end) { /* consume bytes */ }
+/// };
+/// @endcode
+template<typename T>
+struct EventPayloadSerializer {
+    static_assert(std::is_trivially_copyable_v<T>,
+        "Event payloads must be trivially copyable or have an EventPayloadSerializer specialization.");
+
+    /// @brief Appends the raw bytes of value
+    /// @param out Record to append to
+    /// @param value Value to serialize
+    static void Write(EventRecordWriter& out, const T& value)
+    {
+        out.WriteValue(value);
+    }
+
+    /// @brief Reads a value and advances the cursor past it
+    /// @param cursor Read position, advanced by sizeof(T)
+    /// @param end End of the record payload
+    /// @return The deserialized value
+    /// @throws std::runtime_error if the payload is truncated
+    static T Read(const uint8_t*& cursor, const uint8_t* end)
+    {
+        if (static_cast<size_t>(end - cursor) < sizeof(T))
+            throw std::runtime_error("Truncated event record payload.");
+
+        T value;
+        std::memcpy(&value, cursor, sizeof(T));
+        cursor += sizeof(T);
+        return value;
+    }
+};
+
+/// @brief Length-prefixed serializer for std::string payloads
+template<>
+struct EventPayloadSerializer<std::string> {
+    static void Write(EventRecordWriter& out, const std::string& value)
+    {
+        out.WriteValue(static_cast<uint32_t>(value.size()));
+        out.WriteBytes(value.data(), value.size());
+    }
+
+    static std::string Read(const uint8_t*& cursor, const uint8_t* end)
+    {
+        const uint32_t size = EventPayloadSerializer<uint32_t>::Read(cursor, end);
+        if (static_cast<size_t>(end - cursor) < size)
+            throw std::runtime_error("Truncated event record payload.");
+
+        std::string value(reinterpret_cast<const char*>(cursor), size);
+        cursor += size;
+        return value;
+    }
+};
+
+/// @class EventRecorder
+/// @brief Opt-in binary capture of everything flowing through selected Event instances.
+///
+/// Attached events append one record per invoke (stream id, timestamp, serialized arguments)
+/// to a buffer owned by the invoking thread. Buffers are written to one log file per thread
+/// inside a session directory, by default under Paths::PersistentDataDir()/EventRecordings.
+/// Timestamps are raw cycle counter ticks on x86-64 (nanoseconds elsewhere); the tick rate is
+/// stored alongside the logs so the replayer can convert them. While no session is active an
+/// attached event pays one indirect call and a relaxed atomic load per invoke. While recording,
+/// each invoke also takes its thread's uncontended buffer lock and reads the timestamp; under
+/// hypervisors that trap rdtsc the timestamp read is the largest part of the cost.
+///
+/// @code
+/// EventRecorder::Attach(onInput, 1);
+/// EventRecorder::Attach(onSpawn, 2);
+/// auto session = EventRecorder::Start();
+/// // ... run the scenario ...
+/// EventRecorder::Stop();
+/// @endcode
+class EventRecorder {
+public:
+    // Enums
+
+    // Public Fields
+
+    // Constructors and Destructors
+
+    /// @brief Deleted constructor - EventRecorder only exposes static methods
+    EventRecorder() = delete;
+
+    // Public Methods
+
+    /// @brief Starts a new recording session
+    /// @param directory Parent directory for the session; defaults to PersistentDataDir()/EventRecordings
+    /// @return Path of the session directory that receives the per-thread logs
+    /// @throws std::runtime_error if a session is already active or the directory cannot be created
+    static std::filesystem::path Start(const std::filesystem::path& directory = {});
+
+    /// @brief Stops the active session and flushes every thread's buffered records to disk
+    /// @note Has no effect if no session is active
+    static void Stop();
+
+    /// @brief Checks if a recording session is active
+    /// @return true while recording
+    static bool IsRecording() { return _recording.load(std::memory_order_relaxed); }
+
+    /// @brief Writes the calling thread's buffered records to its log file
+    static void Flush();
+
+    /// @brief Records every invoke of an event while a session is active
+    /// @tparam Args Argument types of the event; each needs an EventPayloadSerializer
+    /// @param event The event to record
+    /// @param streamId Identifier written with every record, used to bind the stream on replay
+    /// @note Recording is called directly from Event::Invoke(), not through a listener, and does not count
+    ///       towards the event's Size(). Attaching an event again replaces its stream id.
+    template<typename... Args>
+    static void Attach(Event<Args...>& event, uint32_t streamId)
+    {
+        event._recordStream = streamId;
+        event._recordHook = &Record<std::decay_t<Args>...>;
+    }
+
+    /// @brief Stops recording an event
+    /// @param event The event passed to Attach(); no effect if it is not attached
+    template<typename... Args>
+    static void Detach(Event<Args...>& event)
+    {
+        event._recordHook = nullptr;
+        event._recordStream = 0;
+    }
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    static std::atomic<bool> _recording;
+
+    // Private Methods
+
+    /// @brief Appends one record of an attached event's invoke to the calling thread's buffer
+    /// @tparam Ts Decayed argument types of the event
+    /// @param streamId Stream identifier of the event
+    /// @param args Arguments of the invoke
+    template<typename... Ts>
+    static void Record(uint32_t streamId, const Ts&... args)
+    {
+        if (!IsRecording()) return;
+
+        EventRecordWriter record(streamId);
+        (EventPayloadSerializer<Ts>::Write(record, args), ...);
+        record.Commit();
+    }
+};
+
+/// @class EventReplayer
+/// @brief Re-issues the events captured by EventRecorder against live Event instances.
+///
+/// Loads one log file or a whole session directory, merges all threads' records by timestamp
+/// and invokes the bound events, either honoring the original timing or as fast as possible.
+/// Running at maximum speed turns a capture into a repeatable listener benchmark.
+///
+/// @code
+/// EventReplayer replayer;
+/// replayer.Load(sessionDir);
+/// replayer.Bind(1, onInput);
+/// replayer.Bind(2, onSpawn);
+/// auto stats = replayer.Run(EventReplayer::Speed::Maximum);
+/// @endcode
+class EventReplayer {
+public:
+    // Enums
+
+    /// @brief Pacing used when re-issuing events
+    enum class Speed {
+        Original,   ///< Sleep so events are spaced as they were recorded
+        Maximum     ///< Invoke back to back
+    };
+
+    // Public Fields
+
+    /// @brief Summary of a replay run
+    struct ReplayStats {
+        size_t invoked{0};                      ///< Records dispatched to a bound event
+        size_t skipped{0};                      ///< Records whose stream had no binding
+        std::chrono::nanoseconds recordedSpan{0}; ///< Time between the first and last record
+        std::chrono::nanoseconds elapsed{0};    ///< Wall time spent replaying
+    };
+
+    // Constructors and Destructors
+
+    /// @brief Default constructor.
+    EventReplayer() = default;
+
+    /// @brief Default destructor.
+    ~EventReplayer() = default;
+
+    // Public Methods
+
+    /// @brief Loads a recording
+    /// @param path A single log file, or a session directory whose logs are all loaded
+    /// @throws std::runtime_error if a file cannot be read or is not an event recording
+    /// @note Records from every loaded file are merged in timestamp order
+    void Load(const std::filesystem::path& path);
+
+    /// @brief Binds a recorded stream to the event that should receive it
+    /// @tparam Args Argument types of the event; must match the recorded stream
+    /// @param streamId Stream identifier passed to EventRecorder::Attach()
+    /// @param event Event to invoke for every record of the stream
+    template<typename... Args>
+    void Bind(uint32_t streamId, Event<Args...>& event)
+    {
+        _bindings[streamId] = [&event](const uint8_t* cursor, const uint8_t* end) {
+            // Braced initialization guarantees arguments are read in declaration order
+            std::tuple<std::decay_t<Args>...> values{
+                EventPayloadSerializer<std::decay_t<Args>>::Read(cursor, end)...
+            };
+            std::apply([&event](auto&... unpacked) { event.Invoke(unpacked...); }, values);
+        };
+    }
+
+    /// @brief Re-issues every loaded record to its bound event
+    /// @param speed Pacing of the replay
+    /// @return Counts and timings of the run
+    ReplayStats Run(Speed speed);
+
+    /// @brief Gets the number of loaded records
+    /// @return Number of records across all loaded files
+    size_t Size() const { return _records.size(); }
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    /// @brief Location of one record inside a loaded file
+    struct Record {
+        int64_t timestampNs;
+        uint32_t streamId;
+        size_t file;
+        size_t offset;
+        size_t size;
+    };
+
+    std::vector<std::vector<uint8_t>> _files;
+    std::vector<Record> _records;
+    std::unordered_map<uint32_t, std::function<void(const uint8_t*, const uint8_t*)>> _bindings;
+
+    // Private Methods
+
+    /// @brief Reads one log file and indexes its records
+    /// @param file Path of the log file
+    /// @param ticksPerSecond Timestamp rate of the file's session
+    void LoadFile(const std::filesystem::path& file, double ticksPerSecond);
+
+    /// @brief Reads the timestamp rate stored in a session directory
+    /// @param sessionDir Directory containing the session's logs
+    /// @return Ticks per second, or 1e9 (nanoseconds) if the session has no metadata
+    static double ReadTicksPerSecond(const std::filesystem::path& sessionDir);
+};
+
+} // namespace velecs::common
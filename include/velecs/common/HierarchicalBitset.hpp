@@ -0,0 +1,158 @@
+/// @file    HierarchicalBitset.hpp
+/// @author  Matthew Green
+/// @date    2026-10-18 19:10:52
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/common/BitOps.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace velecs::common {
+
+/// @class HierarchicalBitset
+/// @brief Bitset over object ids with a summary bit per word, so scans skip empty regions.
+///
+/// Summary word s has bit w set when word s * 64 + w has any bit set. Setting a bit is O(1);
+/// iteration and Clear() only visit words that have bits set, so they cost O(set bits) plus
+/// one summary word per 4096 ids. The bitset grows on Set() as ids are used.
+///
+/// @code
+/// HierarchicalBitset moved;
+/// moved.Set(entityId);
+/// moved.ForEach([](uint32_t id) { UpdateTransform(id); });
+/// moved.Clear();
+/// @endcode
+class HierarchicalBitset {
+public:
+    // Enums
+
+    // Public Fields
+
+    // Constructors and Destructors
+
+    /// @brief Default constructor. Creates an empty bitset.
+    HierarchicalBitset() = default;
+
+    /// @brief Default deconstructor.
+    ~HierarchicalBitset() = default;
+
+    // Public Methods
+
+    /// @brief Sets the bit for an id, growing the bitset if needed
+    void Set(uint32_t id)
+    {
+        const size_t word = id >> 6;
+        if (word >= _words.size()) Grow(word);
+
+        _words[word] |= uint64_t{1} << (id & 63);
+        _summary[word >> 6] |= uint64_t{1} << (word & 63);
+    }
+
+    /// @brief Clears the bit for an id
+    void Reset(uint32_t id)
+    {
+        const size_t word = id >> 6;
+        if (word >= _words.size()) return;
+
+        _words[word] &= ~(uint64_t{1} << (id & 63));
+        if (_words[word] == 0) _summary[word >> 6] &= ~(uint64_t{1} << (word & 63));
+    }
+
+    /// @brief Checks the bit for an id
+    bool Test(uint32_t id) const
+    {
+        const size_t word = id >> 6;
+        return word < _words.size() && ((_words[word] >> (id & 63)) & 1);
+    }
+
+    /// @brief Clears every bit, touching only the words that have bits set
+    void Clear()
+    {
+        for (size_t s = 0; s < _summary.size(); ++s)
+        {
+            ForEachSetBit(_summary[s], s * 64, [this](uint64_t word) { _words[word] = 0; });
+            _summary[s] = 0;
+        }
+    }
+
+    /// @brief Checks whether no bits are set
+    bool Empty() const
+    {
+        for (uint64_t summary : _summary)
+        {
+            if (summary != 0) return false;
+        }
+        return true;
+    }
+
+    /// @brief Counts the set bits
+    size_t Count() const
+    {
+        size_t count = 0;
+        for (size_t s = 0; s < _summary.size(); ++s)
+        {
+            ForEachSetBit(_summary[s], s * 64, [this, &count](uint64_t word) { count += PopCount(_words[word]); });
+        }
+        return count;
+    }
+
+    /// @brief Calls a function with every set id, in ascending order
+    /// @param func Callable taking a uint32_t
+    template<typename Func>
+    void ForEach(Func&& func) const
+    {
+        for (size_t s = 0; s < _summary.size(); ++s)
+        {
+            ForEachSetBit(_summary[s], s * 64, [this, &func](uint64_t word) {
+                ForEachSetBit(_words[word], word * 64, [&func](uint64_t id) { func(static_cast<uint32_t>(id)); });
+            });
+        }
+    }
+
+    /// @brief Gets the number of 64-bit words backing the bitset
+    size_t WordCount() const { return _words.size(); }
+
+    /// @brief Gets word i; bit b is id i * 64 + b
+    uint64_t Word(size_t i) const { return i < _words.size() ? _words[i] : 0; }
+
+    /// @brief Gets summary word i; bit w is set when Word(i * 64 + w) is non-zero
+    uint64_t SummaryWord(size_t i) const { return i < _summary.size() ? _summary[i] : 0; }
+
+    /// @brief Gets the number of summary words
+    size_t SummaryWordCount() const { return _summary.size(); }
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    /// @brief One bit per id; always a multiple of 64 words so every word has a summary bit
+    std::vector<uint64_t> _words;
+
+    /// @brief One bit per word of _words
+    std::vector<uint64_t> _summary;
+
+    // Private Methods
+
+    void Grow(size_t word)
+    {
+        size_t summaryWords = (word >> 6) + 1;
+        if (summaryWords < _summary.size() * 2) summaryWords = _summary.size() * 2;
+        _summary.resize(summaryWords, 0);
+        _words.resize(summaryWords * 64, 0);
+    }
+};
+
+} // namespace velecs::common
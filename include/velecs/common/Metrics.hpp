@@ -0,0 +1,344 @@
+/// @file    Metrics.hpp
+/// @author  Matthew Green
+/// @date    2026-10-18 20:06:38
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+/// @brief Set to 0 (CMake option VELECS_COMMON_METRICS=OFF) to compile every metric update out
+#ifndef VELECS_METRICS_ENABLED
+#define VELECS_METRICS_ENABLED 1
+#endif
+
+namespace velecs::common {
+
+/// @class Counter
+/// @brief Monotonic event counter sharded by thread so concurrent increments do not share a cache line.
+///
+/// Obtain counters from Metrics::GetCounter(); they live until the process exits, so hot paths
+/// keep a reference in a function-local static.
+class Counter {
+public:
+    // Enums
+
+    // Public Fields
+
+    /// @brief Number of cache-line sized cells increments are spread over
+    static constexpr size_t SHARD_COUNT = 16;
+
+    // Constructors and Destructors
+
+    /// @brief Creates an unregistered counter; prefer Metrics::GetCounter(), which registers it for export
+    Counter() = default;
+
+    /// @brief Default deconstructor.
+    ~Counter() = default;
+
+    Counter(const Counter&) = delete;
+    Counter& operator=(const Counter&) = delete;
+
+    // Public Methods
+
+    /// @brief Adds to the counter: one relaxed add on the calling thread's cell
+    inline void Add(uint64_t amount = 1) noexcept;
+
+    /// @brief Sums every cell
+    uint64_t Value() const noexcept;
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    struct alignas(64) Cell {
+        std::atomic<uint64_t> value{0};
+    };
+
+    // Private Fields
+
+    Cell _cells[SHARD_COUNT];
+
+    // Private Methods
+};
+
+/// @class Gauge
+/// @brief A value that goes up and down, such as a queue depth or bytes resident.
+class Gauge {
+public:
+    // Enums
+
+    // Public Fields
+
+    // Constructors and Destructors
+
+    /// @brief Creates an unregistered gauge; prefer Metrics::GetGauge(), which registers it for export
+    Gauge() = default;
+
+    /// @brief Default deconstructor.
+    ~Gauge() = default;
+
+    Gauge(const Gauge&) = delete;
+    Gauge& operator=(const Gauge&) = delete;
+
+    // Public Methods
+
+    /// @brief Sets the gauge
+    inline void Set(int64_t value) noexcept;
+
+    /// @brief Adds to the gauge; pass a negative amount to subtract
+    inline void Add(int64_t amount) noexcept;
+
+    /// @brief Gets the current value
+    int64_t Value() const noexcept { return _value.load(std::memory_order_relaxed); }
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    std::atomic<int64_t> _value{0};
+
+    // Private Methods
+};
+
+/// @class Histogram
+/// @brief Log-linear latency histogram in the style of HdrHistogram.
+///
+/// Values below 16 get exact buckets; above that, each power of two is split into 16 linear
+/// buckets, so any recorded value is reported within 6.25%. Recording is a bucket index
+/// computation and a few relaxed atomic adds; reading sums the buckets without locking.
+class Histogram {
+public:
+    // Enums
+
+    // Public Fields
+
+    /// @brief Linear buckets per power of two, as a bit count
+    static constexpr unsigned SUB_BUCKET_BITS = 4;
+
+    /// @brief Buckets covering the full uint64_t range
+    static constexpr size_t BUCKET_COUNT = (64 - SUB_BUCKET_BITS + 1) << SUB_BUCKET_BITS;
+
+    /// @brief Point-in-time summary of a histogram
+    struct Snapshot {
+        uint64_t count{0};
+        uint64_t sum{0};
+        uint64_t max{0};
+        uint64_t p50{0};
+        uint64_t p90{0};
+        uint64_t p99{0};
+        uint64_t p999{0};
+    };
+
+    // Constructors and Destructors
+
+    /// @brief Creates an unregistered histogram; prefer Metrics::GetHistogram(), which registers it for export
+    Histogram() = default;
+
+    /// @brief Default deconstructor.
+    ~Histogram() = default;
+
+    Histogram(const Histogram&) = delete;
+    Histogram& operator=(const Histogram&) = delete;
+
+    // Public Methods
+
+    /// @brief Records a value, typically a duration in nanoseconds
+    inline void Record(uint64_t value) noexcept;
+
+    /// @brief Gets the value below which the given fraction of recorded values fall
+    /// @param quantile Fraction in [0, 1], e.g. 0.99
+    /// @return Upper bound of the bucket holding that rank, or 0 if nothing was recorded
+    uint64_t ValueAtQuantile(double quantile) const noexcept;
+
+    /// @brief Reads count, sum, max and common percentiles in one pass
+    Snapshot TakeSnapshot() const noexcept;
+
+    /// @brief Maps a value to its bucket
+    static constexpr size_t BucketIndex(uint64_t value) noexcept
+    {
+        if (value < (uint64_t{1} << SUB_BUCKET_BITS)) return static_cast<size_t>(value);
+
+        unsigned msb = 63;
+        while (((value >> msb) & 1) == 0) --msb;
+        const unsigned shift = msb - SUB_BUCKET_BITS;
+        const uint64_t mantissa = value >> shift;    // In [16, 32)
+        return ((shift + 1) << SUB_BUCKET_BITS) + static_cast<size_t>(mantissa - (uint64_t{1} << SUB_BUCKET_BITS));
+    }
+
+    /// @brief Gets the largest value that maps to a bucket
+    static constexpr uint64_t BucketUpperBound(size_t index) noexcept
+    {
+        if (index < (size_t{1} << SUB_BUCKET_BITS)) return index;
+
+        const unsigned shift = static_cast<unsigned>(index >> SUB_BUCKET_BITS) - 1;
+        const uint64_t mantissa = (index & ((size_t{1} << SUB_BUCKET_BITS) - 1)) + (uint64_t{1} << SUB_BUCKET_BITS);
+        return ((mantissa + 1) << shift) - 1;
+    }
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    std::atomic<uint64_t> _buckets[BUCKET_COUNT]{};
+    std::atomic<uint64_t> _sum{0};
+    std::atomic<uint64_t> _max{0};
+
+    // Private Methods
+};
+
+/// @class ScopedTimer
+/// @brief Records the time between construction and destruction into a histogram, in nanoseconds.
+///
+/// @code
+/// static Histogram& loadTime = Metrics::GetHistogram("assets.load_ns");
+/// ScopedTimer timer(loadTime);
+/// @endcode
+class ScopedTimer {
+public:
+    explicit ScopedTimer(Histogram& histogram) noexcept;
+    ~ScopedTimer();
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+    Histogram& _histogram;
+    uint64_t _startNs;
+};
+
+/// @class Metrics
+/// @brief Process-wide registry and exporter for counters, gauges and histograms.
+///
+/// Metrics are created on first lookup and never destroyed, so references stay valid and
+/// MetricsExporter (MetricsExporter.hpp) can walk the registry without locking. When metrics are
+/// compiled out (VELECS_METRICS_ENABLED=0) or disabled at runtime, updates cost at most one
+/// relaxed load. This header sits on hot paths, so it stays free of <string> and <filesystem>.
+///
+/// @code
+/// static Counter& misses = Metrics::GetCounter("cache.misses");
+/// misses.Add();
+/// @endcode
+class Metrics {
+public:
+    // Enums
+
+    // Public Fields
+
+    // Constructors and Destructors
+
+    /// @brief Default constructor.
+    Metrics() = default;
+
+    /// @brief Default deconstructor.
+    ~Metrics() = default;
+
+    // Public Methods
+
+    /// @brief Gets or creates a counter
+    /// @param name Name the counter is exported under
+    /// @throws std::runtime_error if the name is already used by another kind of metric
+    static Counter& GetCounter(std::string_view name);
+
+    /// @brief Gets or creates a gauge
+    /// @throws std::runtime_error if the name is already used by another kind of metric
+    static Gauge& GetGauge(std::string_view name);
+
+    /// @brief Gets or creates a histogram
+    /// @throws std::runtime_error if the name is already used by another kind of metric
+    static Histogram& GetHistogram(std::string_view name);
+
+    /// @brief Turns metric updates on or off at runtime; on by default
+    static void SetEnabled(bool enabled) { _enabled.store(enabled, std::memory_order_relaxed); }
+
+    /// @brief Checks whether metric updates are recorded
+    static bool IsEnabled() noexcept
+    {
+#if VELECS_METRICS_ENABLED
+        return _enabled.load(std::memory_order_relaxed);
+#else
+        return false;
+#endif
+    }
+
+    /// @brief Reads the steady clock in nanoseconds; out of line so this header needs no <chrono>
+    static uint64_t NowNs() noexcept;
+
+    /// @brief Gets the calling thread's shard slot
+    static size_t ThreadShard() noexcept
+    {
+        thread_local const size_t shard = _nextShard.fetch_add(1, std::memory_order_relaxed);
+        return shard;
+    }
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    static std::atomic<bool> _enabled;
+    static std::atomic<size_t> _nextShard;
+
+    // Private Methods
+};
+
+// Inline metric updates; these sit on hot paths
+
+inline void Counter::Add(uint64_t amount) noexcept
+{
+    if (!Metrics::IsEnabled()) return;
+    _cells[Metrics::ThreadShard() % SHARD_COUNT].value.fetch_add(amount, std::memory_order_relaxed);
+}
+
+inline void Gauge::Set(int64_t value) noexcept
+{
+    if (!Metrics::IsEnabled()) return;
+    _value.store(value, std::memory_order_relaxed);
+}
+
+inline void Gauge::Add(int64_t amount) noexcept
+{
+    if (!Metrics::IsEnabled()) return;
+    _value.fetch_add(amount, std::memory_order_relaxed);
+}
+
+inline void Histogram::Record(uint64_t value) noexcept
+{
+    if (!Metrics::IsEnabled()) return;
+    _buckets[BucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    _sum.fetch_add(value, std::memory_order_relaxed);
+
+    uint64_t max = _max.load(std::memory_order_relaxed);
+    while (value > max && !_max.compare_exchange_weak(max, value, std::memory_order_relaxed)) {}
+}
+
+inline ScopedTimer::ScopedTimer(Histogram& histogram) noexcept
+    : _histogram(histogram), _startNs(Metrics::IsEnabled() ? Metrics::NowNs() : 0) {}
+
+inline ScopedTimer::~ScopedTimer()
+{
+    if (_startNs != 0) _histogram.Record(Metrics::NowNs() - _startNs);
+}
+
+} // namespace velecs::common
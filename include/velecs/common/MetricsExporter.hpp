@@ -0,0 +1,86 @@
+/// @file    MetricsExporter.hpp
+/// @author  Matthew Green
+/// @date    2026-10-18 21:40:12
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/common/Metrics.hpp"
+
+#include <chrono>
+#include <filesystem>
+#include <string>
+
+namespace velecs::common {
+
+/// @class MetricsExporter
+/// @brief Formats the Metrics registry and writes it to disk, once or periodically.
+///
+/// Kept apart from Metrics.hpp so code that only updates metrics does not pay for <filesystem>.
+/// The background exporter writes to PersistentDataDir()/Metrics/metrics.json (or .txt).
+///
+/// @code
+/// MetricsExporter::Start(std::chrono::seconds(10));
+/// ...
+/// MetricsExporter::Stop();
+/// @endcode
+class MetricsExporter {
+public:
+    // Enums
+
+    /// @brief Snapshot file format
+    enum class Format {
+        Json,  ///< One JSON object keyed by metric name
+        Text   ///< One "name value" line per metric
+    };
+
+    // Public Fields
+
+    // Constructors and Destructors
+
+    /// @brief Default constructor.
+    MetricsExporter() = default;
+
+    /// @brief Default deconstructor.
+    ~MetricsExporter() = default;
+
+    // Public Methods
+
+    /// @brief Formats every registered metric
+    static std::string Snapshot(Format format = Format::Json);
+
+    /// @brief Writes a snapshot, replacing the file atomically
+    /// @param path Destination file
+    /// @throws std::runtime_error if the file cannot be written
+    static void WriteSnapshot(const std::filesystem::path& path, Format format = Format::Json);
+
+    /// @brief Starts a background thread writing a snapshot every interval
+    /// @param interval Time between snapshots
+    /// @param format Snapshot format
+    /// @throws std::runtime_error if Paths is not initialized or the exporter is already running
+    static void Start(std::chrono::milliseconds interval, Format format = Format::Json);
+
+    /// @brief Stops the exporter after writing a final snapshot; no effect if it is not running
+    static void Stop();
+
+    /// @brief Gets the file the exporter writes to
+    /// @throws std::runtime_error if Paths is not initialized
+    static std::filesystem::path ExportPath(Format format = Format::Json);
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    // Private Methods
+};
+
+} // namespace velecs::common
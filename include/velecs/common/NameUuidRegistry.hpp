@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include "velecs/common/Metrics.hpp"
 #include "velecs/common/Uuid.hpp"
 
 #include <string>
@@ -17,6 +18,15 @@
 #include <stdexcept>
 #include <utility>
 #include <memory>
+#include <vector>
+#include <atomic>
+#include <limits>
+#include <algorithm>
+#include <functional>
+#include <future>
+#include <tuple>
+#include <exception>
+#include <chrono>
 
 namespace velecs::common {
 
@@ -43,12 +53,62 @@ namespace velecs::common {
 /// for (const auto& [uuid, name, item] : profiles) {
 ///     // use uuid, name, and item
 /// }
+///
+/// // Iterate over only the items constructed as a specific subclass
+/// profiles.ForEachOfType<GamepadProfile>([](GamepadProfile& profile) { /* ... */ });
+///
+/// // Construct an item on a worker thread; the name and UUID are reserved immediately
+/// profiles.SetAsyncExecutor([&pool](std::function<void()> job) { pool.Submit(std::move(job)); });
+/// auto handle = profiles.EmplaceAsync("StreamedProfile", "profiles/streamed.json");
+/// profiles.GetState(handle.GetUuid()); // EntryState::Pending until construction finishes
+/// profiles.CommitPending();             // Once per frame on the owning thread
 /// @endcode
 template<typename T>
 class NameUuidRegistry {
+private:
+    /// @brief Internal structure storing an owned item and its position in its type bucket
+    struct ItemRecord {
+        std::unique_ptr<T> item;
+        size_t typeIndex;
+        size_t bucketSlot;
+    };
+
+    /// @brief Contiguous list of all items registered with one concrete type
+    /// @details items and uuids are parallel arrays; uuids lets removal patch the record of
+    ///          the element that gets swapped into a vacated slot.
+    struct TypeBucket {
+        std::vector<T*> items;
+        std::vector<Uuid> uuids;
+        size_t itemSize{0};
+    };
+
+    /// @brief Marker for records that are not linked into any type bucket (null items)
+    static constexpr size_t NO_BUCKET = std::numeric_limits<size_t>::max();
+
+    /// @brief Shared state of an item being constructed asynchronously
+    /// @details Written only by the worker before the promise is satisfied; read by the owning
+    ///          thread only after the ready status has been observed.
+    struct PendingSlot {
+        std::string name;
+        size_t typeIndex;
+        size_t itemSize;
+        std::unique_ptr<T> item;
+        T* raw{nullptr};
+        std::promise<void> promise;
+        std::shared_future<void> done;
+    };
+
 public:
     // Enums
 
+    /// @brief Construction state of a registry entry
+    enum class EntryState {
+        Missing,    ///< No entry with this key exists
+        Pending,    ///< Name and UUID are reserved but the item is still being constructed
+        Ready,      ///< The item is constructed (asynchronous items may still await CommitPending())
+        Failed      ///< Asynchronous construction threw; the entry is dropped by CommitPending()
+    };
+
     // Public Fields
 
     /// @brief Structure representing a registry entry with UUID, name, and item reference
@@ -58,10 +118,105 @@ public:
         T& item;
     };
 
+    /// @brief Snapshot of the registry's memory footprint and hash table health
+    /// @details Byte counts are estimates: hash node sizes assume a singly linked node holding
+    ///          the value, a next pointer and a cached hash, and item sizes use the static size of
+    ///          the type each item was emplaced as (T for items passed to Add()).
+    struct RegistryStats {
+        size_t entryCount{0};        ///< Number of items stored
+        size_t nameCount{0};         ///< Number of reserved names
+
+        size_t itemBucketCount{0};   ///< Bucket count of the UUID -> item table
+        size_t nameBucketCount{0};   ///< Bucket count of the name -> UUID table
+        float itemLoadFactor{0.0f};  ///< Load factor of the UUID -> item table
+        float nameLoadFactor{0.0f};  ///< Load factor of the name -> UUID table
+        size_t itemLongestChain{0};  ///< Longest bucket chain in the UUID -> item table
+        size_t nameLongestChain{0};  ///< Longest bucket chain in the name -> UUID table
+
+        size_t typeBucketCount{0};   ///< Number of per-type buckets allocated
+
+        size_t nodeBytes{0};         ///< Hash nodes and bucket arrays of both tables
+        size_t nameBytes{0};         ///< Heap storage of names too long for the small string buffer
+        size_t itemBytes{0};         ///< Heap blocks of the items themselves
+        size_t typeBucketBytes{0};   ///< Per-type pointer and UUID arrays
+
+        /// @brief Gets the total estimated footprint
+        /// @return Sum of all byte estimates
+        size_t TotalBytes() const { return nodeBytes + nameBytes + itemBytes + typeBucketBytes; }
+
+        /// @brief Formats the statistics as a multi-line human readable dump
+        /// @return Debug string suitable for logging
+        std::string ToString() const
+        {
+            return
+                "entries: " + std::to_string(entryCount) + " (names: " + std::to_string(nameCount) + ")\n"
+                "items table: " + std::to_string(itemBucketCount) + " buckets, load " + std::to_string(itemLoadFactor) +
+                    ", longest chain " + std::to_string(itemLongestChain) + "\n"
+                "names table: " + std::to_string(nameBucketCount) + " buckets, load " + std::to_string(nameLoadFactor) +
+                    ", longest chain " + std::to_string(nameLongestChain) + "\n"
+                "type buckets: " + std::to_string(typeBucketCount) + "\n"
+                "bytes: nodes " + std::to_string(nodeBytes) + ", names " + std::to_string(nameBytes) +
+                    ", items " + std::to_string(itemBytes) + ", type buckets " + std::to_string(typeBucketBytes) +
+                    ", total " + std::to_string(TotalBytes());
+        }
+    };
+
+    /// @brief Handle to an item whose construction was started by EmplaceAsyncAs()
+    /// @tparam U The type being constructed
+    /// @details The handle never blocks unless Wait() is called. It stays usable after the
+    ///          registry commits the item, until the item is removed from the registry.
+    template<typename U>
+    class AsyncHandle {
+    public:
+        /// @brief Constructor for async handle
+        /// @param uuid UUID reserved for the item
+        /// @param slot Shared construction state
+        AsyncHandle(const Uuid& uuid, std::shared_ptr<PendingSlot> slot)
+            : _uuid(uuid), _slot(std::move(slot)) {}
+
+        /// @brief Gets the UUID reserved for the item
+        /// @return The item's UUID, valid immediately
+        const Uuid& GetUuid() const { return _uuid; }
+
+        /// @brief Checks whether construction has finished, successfully or not
+        /// @return true if the item is ready or construction failed
+        bool IsDone() const
+        {
+            return _slot->done.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+        }
+
+        /// @brief Gets the construction state without blocking
+        /// @return Pending, Ready or Failed
+        EntryState GetState() const { return StateOf(*_slot); }
+
+        /// @brief Attempts to get the constructed item without blocking
+        /// @return Pointer to the item, or nullptr if still pending or construction failed
+        U* TryGet() const
+        {
+            return GetState() == EntryState::Ready ? static_cast<U*>(_slot->raw) : nullptr;
+        }
+
+        /// @brief Blocks until construction finishes
+        /// @return Reference to the constructed item
+        /// @throws Any exception thrown by U's constructor
+        U& Wait() const
+        {
+            _slot->done.get();
+            return static_cast<U&>(*_slot->raw);
+        }
+
+    private:
+        Uuid _uuid;
+        std::shared_ptr<PendingSlot> _slot;
+    };
+
+    /// @brief Type alias for executors that run asynchronous construction jobs
+    using AsyncExecutor = std::function<void(std::function<void()>)>;
+
     /// @brief Custom iterator for iterating over registry entries
     class iterator {
     private:
-        typename std::unordered_map<Uuid, std::unique_ptr<T>>::const_iterator _itemIt;
+        typename std::unordered_map<Uuid, ItemRecord>::const_iterator _itemIt;
         const std::unordered_map<std::string, Uuid>* _nameToUuid;
         mutable std::string _currentName; // Cache for performance
 
@@ -75,7 +230,7 @@ public:
         /// @brief Constructor for iterator
         /// @param itemIt Iterator to the items map
         /// @param nameToUuid Pointer to the name-to-UUID mapping
-        iterator(typename std::unordered_map<Uuid, std::unique_ptr<T>>::const_iterator itemIt,
+        iterator(typename std::unordered_map<Uuid, ItemRecord>::const_iterator itemIt,
                  const std::unordered_map<std::string, Uuid>* nameToUuid)
             : _itemIt(itemIt), _nameToUuid(nameToUuid) {}
 
@@ -88,7 +243,7 @@ public:
             // Find name (this is O(n) - could be optimized with reverse map)
             for (const auto& [name, nameUuid] : *_nameToUuid) {
                 if (nameUuid == uuid) {
-                    return { uuid, name, *_itemIt->second };
+                    return { uuid, name, *_itemIt->second.item };
                 }
             }
             throw std::runtime_error("Inconsistent registry state");
@@ -171,7 +326,8 @@ public:
         
         try
         {
-            _items[uuid] = std::move(item);
+            // The dynamic type is unknown here, so the item is bucketed under T itself
+            InsertItem(uuid, item, TypeIndexOf<T>(), sizeof(T));
             return uuid;
         }
         catch (...)
@@ -205,7 +361,7 @@ public:
             auto itemPtr = std::make_unique<U>(std::forward<Args>(args)...);
             U& itemRef = *itemPtr; // Get reference before moving (keep as U&)
             
-            auto [itemIt, itemInserted] = _items.try_emplace(uuid, std::move(itemPtr));
+            InsertItem(uuid, itemPtr, TypeIndexOf<U>(), sizeof(U));
             return { itemRef, uuid };
         }
         catch (...)
@@ -227,18 +383,189 @@ public:
         return EmplaceAs<T>(name, std::forward<Args>(args)...);
     }
 
+    /// @brief Reserves a name and UUID and constructs a subclass item on a worker thread
+    /// @tparam U The specific subclass type to construct (must inherit from T)
+    /// @tparam Args Constructor argument types for U
+    /// @param name Unique name for the item
+    /// @param args Arguments for U's constructor; copied or moved into the job (use std::ref to pass references)
+    /// @return Handle that resolves once construction finishes
+    /// @throws std::runtime_error if name already exists or no executor was set with SetAsyncExecutor()
+    /// @details The name and UUID are visible to lookups immediately, with GetState() reporting
+    ///          EntryState::Pending. The finished item joins the registry on the next CommitPending().
+    ///          Construction runs on the executor set by SetAsyncExecutor().
+    /// @note U's constructor must not touch this registry; the registry itself is not thread-safe.
+    template<typename U, typename... Args>
+    AsyncHandle<U> EmplaceAsyncAs(const std::string& name, Args&&... args)
+    {
+        static_assert(std::is_base_of_v<T, U>, "Type U must be type T or inherit from type T.");
+
+        if (!_asyncExecutor)
+        {
+            throw std::runtime_error("NameUuidRegistry::EmplaceAsync() needs an executor; call SetAsyncExecutor() first.");
+        }
+
+        auto uuid = Uuid::GenerateRandom();
+
+        auto [nameIt, nameInserted] = _nameToUuid.try_emplace(name, uuid);
+        if (!nameInserted)
+        {
+            throw std::runtime_error("Name '" + name + "' already exists.");
+        }
+
+        try
+        {
+            auto slot = std::make_shared<PendingSlot>();
+            slot->name = name;
+            slot->typeIndex = TypeIndexOf<U>();
+            slot->itemSize = sizeof(U);
+            slot->done = slot->promise.get_future().share();
+
+            auto construct = [slot, ctorArgs = std::make_tuple(std::forward<Args>(args)...)]() mutable
+            {
+                try
+                {
+                    auto itemPtr = std::apply([](auto&... unpacked) {
+                        return std::make_unique<U>(std::move(unpacked)...);
+                    }, ctorArgs);
+                    slot->raw = itemPtr.get();
+                    slot->item = std::move(itemPtr);
+                    slot->promise.set_value();
+                }
+                catch (...)
+                {
+                    slot->promise.set_exception(std::current_exception());
+                }
+            };
+
+            // Shared so move-only constructor arguments still fit in a copyable std::function
+            auto job = std::make_shared<decltype(construct)>(std::move(construct));
+
+            auto [pendingIt, pendingInserted] = _pending.try_emplace(uuid, slot);
+            try
+            {
+                _asyncExecutor([job]() { (*job)(); });
+            }
+            catch (...)
+            {
+                _pending.erase(pendingIt);
+                throw;
+            }
+
+            return AsyncHandle<U>(uuid, std::move(slot));
+        }
+        catch (...)
+        {
+            _nameToUuid.erase(nameIt);
+            throw;
+        }
+    }
+
+    /// @brief Reserves a name and UUID and constructs an item on a worker thread
+    /// @tparam Args Constructor argument types for T
+    /// @param name Unique name for the item
+    /// @param args Arguments for T's constructor; copied or moved into the job
+    /// @return Handle that resolves once construction finishes
+    /// @throws std::runtime_error if name already exists or no executor was set with SetAsyncExecutor()
+    template<typename... Args>
+    AsyncHandle<T> EmplaceAsync(const std::string& name, Args&&... args)
+    {
+        return EmplaceAsyncAs<T>(name, std::forward<Args>(args)...);
+    }
+
+    /// @brief Sets the executor used to run asynchronous construction jobs
+    /// @param executor Callable that runs the given job on some worker thread, typically a bounded
+    ///                 pool. The registry never spawns threads itself, so the owner of the pool decides
+    ///                 how many run and joins them on shutdown. Jobs hold no reference to the registry.
+    void SetAsyncExecutor(AsyncExecutor executor)
+    {
+        _asyncExecutor = std::move(executor);
+    }
+
+    /// @brief Moves finished asynchronous items into the registry
+    /// @return Number of items that became available to TryGetRef() and iteration
+    /// @details Entries whose construction threw are dropped and their names released.
+    ///          Never blocks; entries still under construction are left pending.
+    /// @throws std::bad_alloc if an item cannot be linked in; that entry is dropped and its name
+    ///         released, and entries not yet visited stay pending for the next call
+    size_t CommitPending()
+    {
+        size_t committed = 0;
+        for (auto it = _pending.begin(); it != _pending.end(); )
+        {
+            PendingSlot& slot = *it->second;
+            const EntryState state = StateOf(slot);
+            if (state == EntryState::Pending)
+            {
+                ++it;
+                continue;
+            }
+
+            if (state == EntryState::Ready)
+            {
+                try
+                {
+                    InsertItem(it->first, slot.item, slot.typeIndex, slot.itemSize);
+                }
+                catch (...)
+                {
+                    // The slot still owns the item; dropping it frees the item instead of leaving a
+                    // Ready slot whose ownership was already given away
+                    _nameToUuid.erase(slot.name);
+                    _pending.erase(it);
+                    throw;
+                }
+                ++committed;
+            }
+            else
+            {
+                _nameToUuid.erase(slot.name);
+            }
+            it = _pending.erase(it);
+        }
+        return committed;
+    }
+
+    /// @brief Gets the construction state of an entry without blocking
+    /// @param uuid UUID of the entry
+    /// @return Missing, Pending, Ready or Failed
+    EntryState GetState(const Uuid& uuid) const
+    {
+        if (_items.find(uuid) != _items.end()) return EntryState::Ready;
+
+        auto pendingIt = _pending.find(uuid);
+        if (pendingIt != _pending.end()) return StateOf(*pendingIt->second);
+
+        return EntryState::Missing;
+    }
+
+    /// @brief Gets the construction state of an entry without blocking
+    /// @param name Name of the entry
+    /// @return Missing, Pending, Ready or Failed
+    EntryState GetState(const std::string& name) const
+    {
+        auto it = _nameToUuid.find(name);
+        return it != _nameToUuid.end() ? GetState(it->second) : EntryState::Missing;
+    }
+
+    /// @brief Gets the number of entries still awaiting CommitPending()
+    /// @return Number of asynchronously constructed entries not yet committed
+    size_t PendingSize() const { return _pending.size(); }
+
     /// @brief Attempts to retrieve a raw pointer by UUID
     /// @param uuid UUID of the item to retrieve
     /// @param outItem Reference to store raw pointer if found
     /// @return true if item was found, false otherwise
     bool TryGetRef(const Uuid& uuid, T*& outItem) const
     {
+        const bool metrics = Metrics::IsEnabled();
+        if (metrics) LookupCounter().Add();
         auto it = _items.find(uuid);
         if (it != _items.end())
         {
-            outItem = it->second.get();
+            outItem = it->second.item.get();
             return true;
         }
+        if (metrics) MissCounter().Add();
         return false;
     }
 
@@ -258,7 +585,7 @@ public:
             {
                 if (nameUuid == uuid)
                 {
-                    outItem = itemIt->second.get();
+                    outItem = itemIt->second.item.get();
                     outName = name;
                     return true;
                 }
@@ -278,6 +605,11 @@ public:
             auto uuid = it->second;
             return TryGetRef(uuid, outItem);
         }
+        if (Metrics::IsEnabled())
+        {
+            LookupCounter().Add();
+            MissCounter().Add();
+        }
         return false;
     }
 
@@ -294,6 +626,11 @@ public:
             outUuid = it->second;
             return TryGetRef(outUuid, outItem);
         }
+        if (Metrics::IsEnabled())
+        {
+            LookupCounter().Add();
+            MissCounter().Add();
+        }
         return false;
     }
 
@@ -349,9 +686,19 @@ public:
             }
             
             // Remove the item
+            UnlinkFromBucket(itemIt->second);
             _items.erase(itemIt);
             return true;
         }
+
+        auto pendingIt = _pending.find(uuid);
+        if (pendingIt != _pending.end())
+        {
+            // The worker keeps its own reference to the slot and simply finishes unobserved
+            _nameToUuid.erase(pendingIt->second->name);
+            _pending.erase(pendingIt);
+            return true;
+        }
         return false;
     }
 
@@ -365,7 +712,17 @@ public:
         {
             auto uuid = nameIt->second;
             _nameToUuid.erase(nameIt);
-            _items.erase(uuid);
+
+            auto itemIt = _items.find(uuid);
+            if (itemIt != _items.end())
+            {
+                UnlinkFromBucket(itemIt->second);
+                _items.erase(itemIt);
+            }
+            else
+            {
+                _pending.erase(uuid);
+            }
             return true;
         }
         return false;
@@ -376,16 +733,92 @@ public:
     {
         _items.clear();
         _nameToUuid.clear();
+        _buckets.clear();
+        _pending.clear();
     }
 
     /// @brief Gets the number of items in the registry
     /// @return Number of items currently stored
+    /// @note Entries still pending asynchronous construction are not counted
     size_t Size() const { return _items.size(); }
 
     /// @brief Checks if the registry is empty
     /// @return true if no items are stored, false otherwise
     bool Empty() const { return _items.empty(); }
 
+    /// @brief Invokes a function on every item that was constructed as exactly type U
+    /// @tparam U The concrete type to visit (must be T or inherit from T)
+    /// @tparam Func Callable type accepting a U&
+    /// @param func Function to call for each matching item
+    /// @details Walks only U's contiguous bucket instead of scanning the whole registry, and calls
+    ///          func through a U& so calls to U's members can be devirtualized (e.g. when U is final).
+    ///          Items added through Add() are bucketed under T since their dynamic type is unknown.
+    /// @note Items of types derived from U are not visited; they live in their own buckets.
+    /// @warning Adding or removing items from inside func invalidates the walk.
+    template<typename U, typename Func>
+    void ForEachOfType(Func&& func) const
+    {
+        static_assert(std::is_base_of_v<T, U>, "Type U must be type T or inherit from type T.");
+
+        const size_t typeIndex = TypeIndexOf<U>();
+        if (typeIndex >= _buckets.size()) return;
+
+        for (T* item : _buckets[typeIndex].items)
+        {
+            func(static_cast<U&>(*item));
+        }
+    }
+
+    /// @brief Gets the number of items that were constructed as exactly type U
+    /// @tparam U The concrete type to count (must be T or inherit from T)
+    /// @return Number of items currently stored in U's bucket
+    template<typename U>
+    size_t SizeOfType() const
+    {
+        static_assert(std::is_base_of_v<T, U>, "Type U must be type T or inherit from type T.");
+
+        const size_t typeIndex = TypeIndexOf<U>();
+        return typeIndex < _buckets.size() ? _buckets[typeIndex].items.size() : 0;
+    }
+
+    /// @brief Collects memory footprint and load statistics for this registry
+    /// @return Snapshot of entry counts, table health and estimated byte usage
+    /// @note This operation is O(n + buckets) and intended for diagnostics, not per-frame use
+    RegistryStats Stats() const
+    {
+        RegistryStats stats;
+        stats.entryCount = _items.size();
+        stats.nameCount = _nameToUuid.size();
+
+        stats.itemBucketCount = _items.bucket_count();
+        stats.nameBucketCount = _nameToUuid.bucket_count();
+        stats.itemLoadFactor = _items.load_factor();
+        stats.nameLoadFactor = _nameToUuid.load_factor();
+        stats.itemLongestChain = LongestChain(_items);
+        stats.nameLongestChain = LongestChain(_nameToUuid);
+
+        stats.nodeBytes = EstimateTableBytes(_items) + EstimateTableBytes(_nameToUuid);
+
+        const size_t inlineCapacity = std::string().capacity();
+        for (const auto& [name, uuid] : _nameToUuid)
+        {
+            if (name.capacity() > inlineCapacity)
+            {
+                stats.nameBytes += name.capacity() + 1;
+            }
+        }
+
+        stats.typeBucketCount = _buckets.size();
+        stats.typeBucketBytes = _buckets.capacity() * sizeof(TypeBucket);
+        for (const TypeBucket& bucket : _buckets)
+        {
+            stats.itemBytes += bucket.items.size() * bucket.itemSize;
+            stats.typeBucketBytes += bucket.items.capacity() * sizeof(T*) + bucket.uuids.capacity() * sizeof(Uuid);
+        }
+
+        return stats;
+    }
+
 protected:
     // Protected Fields
 
@@ -395,12 +828,149 @@ private:
     // Private Fields
 
     /// @brief Storage for items indexed by UUID
-    std::unordered_map<Uuid, std::unique_ptr<T>> _items;
+    std::unordered_map<Uuid, ItemRecord> _items;
     
     /// @brief Mapping from string names to their corresponding UUIDs
     std::unordered_map<std::string, Uuid> _nameToUuid;
 
+    /// @brief Per-concrete-type item lists, indexed by TypeIndexOf<U>()
+    std::vector<TypeBucket> _buckets;
+
+    /// @brief Entries reserved by EmplaceAsyncAs() whose items have not been committed yet
+    std::unordered_map<Uuid, std::shared_ptr<PendingSlot>> _pending;
+
+    /// @brief Executor for asynchronous construction jobs; required by EmplaceAsync()
+    AsyncExecutor _asyncExecutor;
+
+    /// @brief Next dense type index to hand out for this registry's item family
+    inline static std::atomic<size_t> _nextTypeIndex{0};
+
     // Private Methods
+
+    /// @brief Counts item lookups across all registries
+    static Counter& LookupCounter()
+    {
+        static Counter& counter = Metrics::GetCounter("registry.lookups");
+        return counter;
+    }
+
+    /// @brief Counts item lookups that found nothing, across all registries
+    static Counter& MissCounter()
+    {
+        static Counter& counter = Metrics::GetCounter("registry.misses");
+        return counter;
+    }
+
+    /// @brief Gets the construction state of a pending slot without blocking
+    /// @param slot The slot to inspect
+    /// @return Pending, Ready or Failed
+    static EntryState StateOf(const PendingSlot& slot)
+    {
+        if (slot.done.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        {
+            return EntryState::Pending;
+        }
+        return slot.raw != nullptr ? EntryState::Ready : EntryState::Failed;
+    }
+
+    /// @brief Gets the dense type index of U within the NameUuidRegistry<T> family
+    /// @tparam U The concrete item type
+    /// @return Index that is stable for the lifetime of the process and shared by all registries of T
+    template<typename U>
+    static size_t TypeIndexOf()
+    {
+        static const size_t typeIndex = _nextTypeIndex.fetch_add(1);
+        return typeIndex;
+    }
+
+    /// @brief Stores an owned item under uuid and links it into the bucket for typeIndex
+    /// @param uuid UUID to store the item under
+    /// @param item Owned item to store; moved from only once every allocation has succeeded
+    /// @param typeIndex Bucket index of the item's concrete type
+    /// @param itemSize Size in bytes of the item's concrete type, recorded for Stats()
+    /// @note Leaves the registry and item unchanged if any allocation throws
+    void InsertItem(const Uuid& uuid, std::unique_ptr<T>& item, size_t typeIndex, size_t itemSize)
+    {
+        if (!item)
+        {
+            _items.try_emplace(uuid, ItemRecord{ nullptr, NO_BUCKET, NO_BUCKET });
+            return;
+        }
+
+        if (typeIndex >= _buckets.size())
+        {
+            _buckets.resize(typeIndex + 1);
+        }
+
+        TypeBucket& bucket = _buckets[typeIndex];
+        const size_t bucketSlot = bucket.items.size();
+        bucket.itemSize = itemSize;
+
+        bucket.items.push_back(item.get());
+        try
+        {
+            bucket.uuids.push_back(uuid);
+            try
+            {
+                auto recordIt = _items.try_emplace(uuid, ItemRecord{ nullptr, typeIndex, bucketSlot }).first;
+                recordIt->second.item = std::move(item);
+            }
+            catch (...)
+            {
+                bucket.uuids.pop_back();
+                throw;
+            }
+        }
+        catch (...)
+        {
+            bucket.items.pop_back();
+            throw;
+        }
+    }
+
+    /// @brief Removes a record's item from its type bucket by swapping the last element into its slot
+    /// @param record The record being removed from the registry
+    void UnlinkFromBucket(const ItemRecord& record)
+    {
+        if (record.typeIndex == NO_BUCKET) return;
+
+        TypeBucket& bucket = _buckets[record.typeIndex];
+        const size_t lastSlot = bucket.items.size() - 1;
+
+        if (record.bucketSlot != lastSlot)
+        {
+            bucket.items[record.bucketSlot] = bucket.items[lastSlot];
+            bucket.uuids[record.bucketSlot] = bucket.uuids[lastSlot];
+            _items.find(bucket.uuids[record.bucketSlot])->second.bucketSlot = record.bucketSlot;
+        }
+
+        bucket.items.pop_back();
+        bucket.uuids.pop_back();
+    }
+
+    /// @brief Finds the longest bucket chain of an unordered container
+    /// @param table Container to inspect
+    /// @return Number of elements in the fullest bucket
+    template<typename Table>
+    static size_t LongestChain(const Table& table)
+    {
+        size_t longest = 0;
+        for (size_t i = 0; i < table.bucket_count(); ++i)
+        {
+            longest = std::max(longest, table.bucket_size(i));
+        }
+        return longest;
+    }
+
+    /// @brief Estimates the heap bytes used by an unordered container's nodes and bucket array
+    /// @param table Container to inspect
+    /// @return Estimated node plus bucket array bytes
+    template<typename Table>
+    static size_t EstimateTableBytes(const Table& table)
+    {
+        constexpr size_t nodeSize = sizeof(typename Table::value_type) + sizeof(void*) + sizeof(size_t);
+        return table.size() * nodeSize + table.bucket_count() * sizeof(void*);
+    }
 };
 
 } // namespace velecs::common
@@ -0,0 +1,287 @@
+/// @file    PackedFields.hpp
+/// @author  Matthew Green
+/// @date    2026-10-18 18:52:36
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+
+namespace velecs::common {
+
+namespace detail {
+
+/// @brief Unsigned integer type a field value is converted through
+template<typename T, bool = std::is_enum_v<T>>
+struct PackedRaw { using Type = std::make_unsigned_t<std::underlying_type_t<T>>; };
+
+template<typename T>
+struct PackedRaw<T, false> { using Type = std::make_unsigned_t<std::conditional_t<std::is_same_v<T, bool>, uint8_t, T>>; };
+
+} // namespace detail
+
+/// @brief Describes one field of a PackedFields layout
+/// @tparam E Enum (including BitfieldEnum types), integer or bool stored in the field. Signed integers are
+///         stored in two's complement and sign-extended when read; enums are always read back unsigned.
+/// @tparam Bits Width of the field in bits
+/// @tparam Max Largest value the field must hold, e.g. the All value of a flag enum; checked against
+///         Bits at compile time. Leave defaulted to skip the check.
+template<typename E, unsigned Bits, E Max = E{}>
+struct Field {
+    static_assert(std::is_enum_v<E> || std::is_integral_v<E>, "Field type must be an enum, integer or bool.");
+    static_assert(Bits > 0 && Bits <= 64, "Field width must be between 1 and 64 bits.");
+
+    using Type = E;
+    using Raw = typename detail::PackedRaw<E>::Type;
+
+    static_assert(Bits <= sizeof(Raw) * 8, "Field width exceeds the size of its type.");
+
+    /// @brief Width of the field in bits
+    static constexpr unsigned BITS = Bits;
+
+    /// @brief Mask of the field's bits, before shifting into place
+    static constexpr uint64_t MASK = Bits == 64 ? ~uint64_t{0} : (uint64_t{1} << Bits) - 1;
+
+    /// @brief Whether the field holds a signed integer, which is sign-extended when read
+    static constexpr bool IS_SIGNED = std::is_integral_v<E> && std::is_signed_v<E>;
+
+    /// @brief Checks whether a value can be stored without losing bits
+    static constexpr bool Fits(E value) noexcept
+    {
+        if constexpr (IS_SIGNED)
+        {
+            // In range when the bits above the field are all copies of the field's sign bit
+            const uint64_t high = static_cast<uint64_t>(static_cast<int64_t>(value)) & ~(MASK >> 1);
+            return high == 0 || high == ~(MASK >> 1);
+        }
+        else
+        {
+            return (static_cast<uint64_t>(static_cast<Raw>(value)) & ~MASK) == 0;
+        }
+    }
+
+    static_assert(Fits(Max), "Field is too narrow for its declared maximum value.");
+};
+
+/// @class PackedFields
+/// @brief Several small enums, flag sets and integers packed into one 32- or 64-bit word.
+///
+/// The layout is computed at compile time: fields are placed in declaration order starting at
+/// bit 0, and the storage is uint32_t when they fit in 32 bits and uint64_t otherwise. Get and
+/// Set are a shift and a mask with no branches. Values wider than their field are truncated by
+/// Set; use Field::Fits to check, or declare a field's maximum so the width is checked at compile time.
+///
+/// @tparam Fields Field<E, Bits[, Max]> descriptions, in bit order
+///
+/// @code
+/// using RenderState = PackedFields<
+///     Field<BlendMode, 3>,
+///     Field<MyFlags, 4, MyFlags::All>,
+///     Field<uint8_t, 5>>;          // layer
+///
+/// RenderState state;
+/// state.Set<0>(BlendMode::Additive);
+/// state.Set<MyFlags>(MyFlags::Flag1 | MyFlags::Flag3);
+/// if (state.Get<1>() == MyFlags::Flag1) { ... }
+///
+/// // Pull one field out of a whole array of packed components
+/// RenderState::Extract<2>(states.data(), states.size(), layers.data());
+/// @endcode
+template<typename... Fields>
+class PackedFields {
+    static_assert(sizeof...(Fields) > 0, "PackedFields needs at least one field.");
+
+public:
+    // Enums
+
+    // Public Fields
+
+    /// @brief Total width of all fields
+    static constexpr unsigned TOTAL_BITS = (Fields::BITS + ...);
+    static_assert(TOTAL_BITS <= 64, "PackedFields layout does not fit in 64 bits.");
+
+    /// @brief Word the fields are packed into
+    using Storage = std::conditional_t<(TOTAL_BITS <= 32), uint32_t, uint64_t>;
+
+    /// @brief Number of fields
+    static constexpr size_t FIELD_COUNT = sizeof...(Fields);
+
+    /// @brief Type stored in field I
+    template<size_t I>
+    using FieldType = typename std::tuple_element_t<I, std::tuple<Fields...>>::Type;
+
+    /// @brief Bit offset of field I
+    template<size_t I>
+    static constexpr unsigned OFFSET = [] {
+        constexpr unsigned widths[] = {Fields::BITS...};
+        unsigned offset = 0;
+        for (size_t i = 0; i < I; ++i) offset += widths[i];
+        return offset;
+    }();
+
+    /// @brief Width of field I in bits
+    template<size_t I>
+    static constexpr unsigned WIDTH = std::tuple_element_t<I, std::tuple<Fields...>>::BITS;
+
+    /// @brief Mask of field I's bits in the packed word
+    template<size_t I>
+    static constexpr Storage MASK = static_cast<Storage>(std::tuple_element_t<I, std::tuple<Fields...>>::MASK << OFFSET<I>);
+
+    /// @brief Index of the single field storing type E
+    template<typename E>
+    static constexpr size_t INDEX_OF = [] {
+        constexpr bool matches[] = {std::is_same_v<typename Fields::Type, E>...};
+        size_t index = FIELD_COUNT;
+        size_t count = 0;
+        for (size_t i = 0; i < FIELD_COUNT; ++i)
+        {
+            if (matches[i])
+            {
+                index = i;
+                ++count;
+            }
+        }
+        return count == 1 ? index : FIELD_COUNT;
+    }();
+
+    // Constructors and Destructors
+
+    /// @brief Default constructor. All fields are zero.
+    constexpr PackedFields() noexcept = default;
+
+    /// @brief Constructs with every field set
+    /// @param values One value per field, in field order
+    constexpr explicit PackedFields(typename Fields::Type... values) noexcept
+    {
+        SetAll(std::index_sequence_for<Fields...>{}, values...);
+    }
+
+    /// @brief Default deconstructor.
+    ~PackedFields() = default;
+
+    // Public Methods
+
+    /// @brief Reinterprets a raw packed word
+    static constexpr PackedFields FromRaw(Storage raw) noexcept
+    {
+        PackedFields fields;
+        fields._bits = raw;
+        return fields;
+    }
+
+    /// @brief Gets the raw packed word
+    constexpr Storage Raw() const noexcept { return _bits; }
+
+    /// @brief Gets field I
+    template<size_t I>
+    constexpr FieldType<I> Get() const noexcept
+    {
+        return FromField<I>(static_cast<Storage>((_bits & MASK<I>) >> OFFSET<I>));
+    }
+
+    /// @brief Gets the field storing type E
+    template<typename E>
+    constexpr E Get() const noexcept
+    {
+        static_assert(INDEX_OF<E> < FIELD_COUNT, "Type must name exactly one field; use Get<index>() instead.");
+        return Get<INDEX_OF<E>>();
+    }
+
+    /// @brief Sets field I, truncating the value to the field's width
+    template<size_t I>
+    constexpr void Set(FieldType<I> value) noexcept
+    {
+        using Raw = typename detail::PackedRaw<FieldType<I>>::Type;
+        Storage bits = static_cast<Storage>(static_cast<Storage>(static_cast<Raw>(value)) << OFFSET<I>);
+        _bits = static_cast<Storage>((_bits & ~MASK<I>) | (bits & MASK<I>));
+    }
+
+    /// @brief Sets the field storing type E, truncating the value to the field's width
+    template<typename E>
+    constexpr void Set(E value) noexcept
+    {
+        static_assert(INDEX_OF<E> < FIELD_COUNT, "Type must name exactly one field; use Set<index>() instead.");
+        Set<INDEX_OF<E>>(value);
+    }
+
+    /// @brief Reads field I from every element of an array
+    /// @param source Packed values
+    /// @param count Number of elements
+    /// @param out Receives count values
+    /// @note A plain shift-and-mask loop over a trivially copyable word, which compilers vectorize
+    template<size_t I>
+    static void Extract(const PackedFields* source, size_t count, FieldType<I>* out) noexcept
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            out[i] = FromField<I>(static_cast<Storage>((source[i]._bits & MASK<I>) >> OFFSET<I>));
+        }
+    }
+
+    /// @brief Counts the elements of an array whose field I equals a value
+    template<size_t I>
+    static size_t Count(const PackedFields* source, size_t count, FieldType<I> value) noexcept
+    {
+        PackedFields probe;
+        probe.Set<I>(value);
+        const Storage wanted = probe._bits;
+
+        size_t matches = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            matches += (source[i]._bits & MASK<I>) == wanted;
+        }
+        return matches;
+    }
+
+    constexpr bool operator==(const PackedFields& other) const noexcept { return _bits == other._bits; }
+    constexpr bool operator!=(const PackedFields& other) const noexcept { return _bits != other._bits; }
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    Storage _bits{0};
+
+    // Private Methods
+
+    template<size_t I>
+    static constexpr FieldType<I> FromField(Storage value) noexcept
+    {
+        using Raw = typename detail::PackedRaw<FieldType<I>>::Type;
+        if constexpr (std::is_same_v<FieldType<I>, bool>)
+        {
+            return value != 0;
+        }
+        else if constexpr (std::tuple_element_t<I, std::tuple<Fields...>>::IS_SIGNED)
+        {
+            // Flip-and-subtract sign extension of the field's top bit
+            constexpr uint64_t sign = uint64_t{1} << (WIDTH<I> - 1);
+            return static_cast<FieldType<I>>(static_cast<int64_t>((static_cast<uint64_t>(value) ^ sign) - sign));
+        }
+        else
+        {
+            return static_cast<FieldType<I>>(static_cast<Raw>(value));
+        }
+    }
+
+    template<size_t... I>
+    constexpr void SetAll(std::index_sequence<I...>, typename Fields::Type... values) noexcept
+    {
+        (Set<I>(values), ...);
+    }
+};
+
+} // namespace velecs::common
@@ -11,8 +11,10 @@
 #pragma once
 
 #include <filesystem>
+#include <mutex>
 #include <stdexcept>
 #include <optional>
+#include <string>
 
 namespace velecs::common {
 
@@ -25,6 +27,12 @@ class Paths {
 public:
     // Enums
 
+    /// @brief Storage tier for cache directories
+    enum class CacheTier {
+        Fast,    ///< RAM-backed, cleared on reboot ($XDG_RUNTIME_DIR or /dev/shm where available)
+        Durable  ///< Survives reboots, under PersistentDataDir()
+    };
+
     // Public Fields
 
     // Constructors and Destructors
@@ -74,6 +82,20 @@ public:
     ///          Unix-like: ~/.config/{COMPANY NAME}/{APP TITLE}
     static const std::filesystem::path& PersistentDataDir();
 
+    // ----------------- Cache directories -----------------
+
+    /// @brief Gets the cache directory for a storage tier
+    /// @param tier The tier to get the directory for
+    /// @return Absolute path to the tier's cache directory
+    /// @throws std::runtime_error if not initialized
+    /// @note Both directories are created on the first call
+    /// @details Durable: PersistentDataDir/Cache
+    ///          Fast, Unix-like: $XDG_RUNTIME_DIR/{COMPANY NAME}/{APP TITLE}/Cache, else /dev/shm/{COMPANY NAME}-{APP TITLE}-{UID}/Cache
+    ///          Fast, Windows: %TEMP%/{COMPANY NAME}/{APP TITLE}/Cache (no RAM-backed tier)
+    ///          Falls back to the durable directory when no fast location is usable. On Unix-like systems the fast
+    ///          directory is created 0700 and only used if it is a real directory owned by the current user.
+    static const std::filesystem::path& CacheDir(CacheTier tier);
+
 protected:
     // Protected Fields
 
@@ -89,6 +111,13 @@ private:
 
     static std::filesystem::path _persistentDataDir;
 
+    static std::string _company;
+    static std::string _appTitle;
+    static std::once_flag _cacheDirsOnce;
+
+    static std::filesystem::path _fastCacheDir;
+    static std::filesystem::path _durableCacheDir;
+
     // Private Methods
 
     /// @brief Throws exception if not initialized
@@ -101,6 +130,12 @@ private:
     /// @return Absolute path to the created persistent data directory
     /// @throws std::runtime_error if unable to determine user directories
     static std::filesystem::path CreateAndGetPersistentDirPath(const std::string& company, const std::string& appTitle);
+
+    /// @brief Creates and returns the platform-specific fast cache directory path
+    /// @param company Company name for directory organization
+    /// @param appTitle Application title for directory organization
+    /// @return Absolute path to the created fast cache directory, or an empty path if none is usable or safe
+    static std::filesystem::path CreateAndGetFastCacheDirPath(const std::string& company, const std::string& appTitle);
 };
 
 } // namespace velecs::common
@@ -0,0 +1,157 @@
+/// @file    RoaringBitmap.hpp
+/// @author  Matthew Green
+/// @date    2026-10-18 18:27:13
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/common/BitOps.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace velecs::common {
+
+/// @class RoaringBitmap
+/// @brief Compressed set of 32-bit row ids.
+///
+/// Ids are split into 65536-wide chunks by their high 16 bits. A sparse chunk stores its low
+/// halves in a sorted array; a chunk holding more than 4096 ids switches to a 1024-word bitmap.
+/// Set operations work chunk by chunk, so their cost follows the size of the inputs and
+/// results rather than the id range.
+///
+/// @code
+/// RoaringBitmap visible, dirty;
+/// visible.Add(7);
+/// dirty.Add(7);
+/// RoaringBitmap redraw = RoaringBitmap::And(visible, dirty);
+/// redraw.ForEach([](uint32_t row) { ... });
+/// @endcode
+class RoaringBitmap {
+public:
+    // Enums
+
+    // Public Fields
+
+    /// @brief Largest number of ids an array chunk holds before it becomes a bitmap chunk
+    static constexpr uint32_t ARRAY_CHUNK_LIMIT = 4096;
+
+    // Constructors and Destructors
+
+    /// @brief Default constructor. Creates an empty set.
+    RoaringBitmap() = default;
+
+    /// @brief Default deconstructor.
+    ~RoaringBitmap() = default;
+
+    // Public Methods
+
+    /// @brief Adds an id
+    /// @return true if the id was not already present
+    bool Add(uint32_t value);
+
+    /// @brief Adds every id in [begin, end)
+    void AddRange(uint32_t begin, uint32_t end);
+
+    /// @brief Removes an id
+    /// @return true if the id was present
+    bool Remove(uint32_t value);
+
+    /// @brief Checks whether an id is present
+    bool Contains(uint32_t value) const;
+
+    /// @brief Removes every id
+    void Clear() { _chunks.clear(); }
+
+    /// @brief Gets the number of ids in the set
+    uint64_t Cardinality() const;
+
+    /// @brief Checks whether the set has no ids
+    bool Empty() const { return _chunks.empty(); }
+
+    /// @brief Calls a function with every id, in ascending order
+    /// @param func Callable taking a uint32_t
+    template<typename Func>
+    void ForEach(Func&& func) const
+    {
+        for (const Chunk& chunk : _chunks)
+        {
+            const uint32_t high = static_cast<uint32_t>(chunk.key) << 16;
+            if (chunk.IsBitmap())
+            {
+                for (uint32_t w = 0; w < BITMAP_WORDS; ++w)
+                {
+                    ForEachSetBit(chunk.bits[w], high | (w * 64), [&func](uint64_t value) {
+                        func(static_cast<uint32_t>(value));
+                    });
+                }
+            }
+            else
+            {
+                for (uint16_t low : chunk.array)
+                {
+                    func(high | low);
+                }
+            }
+        }
+    }
+
+    /// @brief Gets every id, in ascending order
+    std::vector<uint32_t> ToVector() const;
+
+    /// @brief Gets the ids present in both sets
+    static RoaringBitmap And(const RoaringBitmap& a, const RoaringBitmap& b);
+
+    /// @brief Gets the ids present in either set
+    static RoaringBitmap Or(const RoaringBitmap& a, const RoaringBitmap& b);
+
+    /// @brief Gets the ids present in a but not in b
+    static RoaringBitmap AndNot(const RoaringBitmap& a, const RoaringBitmap& b);
+
+    bool operator==(const RoaringBitmap& other) const;
+    bool operator!=(const RoaringBitmap& other) const { return !(*this == other); }
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    static constexpr uint32_t BITMAP_WORDS = 65536 / 64;
+
+    /// @brief The ids sharing one value of the high 16 bits
+    struct Chunk {
+        uint16_t key{0};
+        uint32_t cardinality{0};
+
+        /// @brief Sorted low halves; used while the chunk is sparse
+        std::vector<uint16_t> array;
+
+        /// @brief BITMAP_WORDS words when dense, empty otherwise
+        std::vector<uint64_t> bits;
+
+        bool IsBitmap() const { return !bits.empty(); }
+        bool Contains(uint16_t low) const;
+
+        /// @brief Switches representation to whichever one suits the cardinality
+        void Normalize();
+    };
+
+    // Private Fields
+
+    /// @brief Non-empty chunks sorted by key
+    std::vector<Chunk> _chunks;
+
+    // Private Methods
+
+    static Chunk AndChunks(const Chunk& a, const Chunk& b);
+    static Chunk OrChunks(const Chunk& a, const Chunk& b);
+    static Chunk AndNotChunks(const Chunk& a, const Chunk& b);
+};
+
+} // namespace velecs::common
@@ -0,0 +1,272 @@
+/// @file    SharedEventChannel.hpp
+/// @author  Matthew Green
+/// @date    2026-10-18 12:44:27
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/common/Event.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+namespace velecs::common {
+
+/// @class SharedEventChannel
+/// @brief Broadcast ring buffer in POSIX shared memory for cross-process event delivery.
+///
+/// Every process that opens the same channel name sees every message published by the other
+/// processes, in publication order, without any serialization step: payloads are copied as raw
+/// bytes into fixed-size slots guarded by per-slot sequence numbers. Readers sleep on a futex in
+/// the shared segment and are woken by publishers, giving microsecond delivery latency.
+/// Readers that fall more than a full ring behind skip the overwritten messages and count them
+/// in Overruns(). A message whose publisher dies or stalls mid-write is skipped the same way once
+/// later messages have been published and it stays unfinished for 100 ms, so one crashed process
+/// cannot stall every reader.
+///
+/// Usually used through EventBridge rather than directly.
+///
+/// @note Linux only; constructing a channel on other platforms throws NotImplementedException.
+///
+/// @code
+/// SharedEventChannel channel("velecs-editor-bridge");
+/// EventBridge<Uuid, float> selection(channel, 1, onSelectionChanged);
+///
+/// // Receiving side, e.g. once per frame or on a dedicated thread
+/// channel.Poll();
+/// channel.WaitAndPoll(std::chrono::milliseconds(5));
+/// @endcode
+class SharedEventChannel {
+public:
+    // Enums
+
+    // Public Fields
+
+    /// @brief Handler for messages of one event id: payload bytes and their size
+    using Handler = std::function<void(const uint8_t*, size_t)>;
+
+    /// @brief Default number of slots in the ring
+    static constexpr uint32_t DEFAULT_SLOT_COUNT = 4096;
+
+    /// @brief Default payload capacity of each slot in bytes
+    static constexpr uint32_t DEFAULT_SLOT_PAYLOAD = 192;
+
+    // Constructors and Destructors
+
+    /// @brief Opens the named channel, creating and initializing it if no process has yet
+    /// @param name Channel name shared by all participating processes (no slashes)
+    /// @param slotCount Number of ring slots, used only when creating the channel
+    /// @param slotPayload Payload capacity per slot in bytes, used only when creating the channel
+    /// @throws std::invalid_argument if the name is empty or contains '/', or slotCount or slotPayload is 0
+    /// @throws std::runtime_error if the shared memory cannot be created, opened or mapped
+    /// @throws NotImplementedException on platforms without POSIX shared memory and futexes
+    explicit SharedEventChannel(const std::string& name,
+                                uint32_t slotCount = DEFAULT_SLOT_COUNT,
+                                uint32_t slotPayload = DEFAULT_SLOT_PAYLOAD);
+
+    /// @brief Destructor. Unmaps the segment; the channel persists until Unlink() is called.
+    ~SharedEventChannel();
+
+    SharedEventChannel(const SharedEventChannel&) = delete;
+    SharedEventChannel& operator=(const SharedEventChannel&) = delete;
+
+    // Public Methods
+
+    /// @brief Removes the named channel from the system once every process has closed it
+    /// @param name Channel name passed to the constructor
+    /// @throws std::invalid_argument if the name is empty or contains '/'
+    static void Unlink(const std::string& name);
+
+    /// @brief Publishes a message to every other process attached to the channel
+    /// @param eventId Identifier used by receivers to pick a handler
+    /// @param data Payload bytes
+    /// @param size Payload size in bytes
+    /// @throws std::length_error if size exceeds the channel's slot payload capacity
+    /// @note If this publisher is descheduled long enough for the ring to lap its ticket, the message is
+    ///       dropped rather than overwriting the newer one
+    void Publish(uint32_t eventId, const void* data, size_t size);
+
+    /// @brief Registers the handler for messages with the given event id
+    /// @param eventId Identifier of the messages to handle
+    /// @param handler Function receiving the payload of each message
+    /// @note Replaces any existing handler for the id
+    void Subscribe(uint32_t eventId, Handler handler);
+
+    /// @brief Removes the handler for an event id
+    /// @param eventId Identifier whose handler should be removed
+    void Unsubscribe(uint32_t eventId);
+
+    /// @brief Delivers every message published by other processes since the last poll
+    /// @return Number of messages dispatched to a handler
+    size_t Poll();
+
+    /// @brief Sleeps until a message arrives or the timeout elapses, then delivers pending messages
+    /// @param timeout Maximum time to sleep when no message is pending
+    /// @return Number of messages dispatched to a handler
+    size_t WaitAndPoll(std::chrono::microseconds timeout);
+
+    /// @brief Gets the payload capacity of each slot
+    /// @return Maximum payload size in bytes accepted by Publish()
+    uint32_t SlotPayload() const { return _slotPayload; }
+
+    /// @brief Gets the number of messages skipped because this reader fell a full ring behind or their
+    ///        publisher never finished writing them
+    /// @return Total dropped messages since the channel was opened
+    uint64_t Overruns() const { return _overruns; }
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    int _fd{-1};
+    void* _mapping{nullptr};
+    size_t _mappingSize{0};
+
+    uint32_t _slotCount{0};
+    uint32_t _slotPayload{0};
+    size_t _slotStride{0};
+
+    uint64_t _readTicket{0};
+    uint64_t _overruns{0};
+    uint64_t _senderId{0};
+
+    /// @brief Unfinished ticket the reader is waiting on while later tickets exist, and since when
+    bool _stalled{false};
+    uint64_t _stallTicket{0};
+    std::chrono::steady_clock::time_point _stallSince;
+
+    std::unordered_map<uint32_t, Handler> _handlers;
+    std::vector<uint8_t> _scratch;
+
+    // Private Methods
+
+    /// @brief Copies the next complete message into the scratch buffer
+    /// @param outEventId Event id of the message
+    /// @param outSize Payload size of the message
+    /// @param outFromSelf Whether this process published the message
+    /// @return true if a message was read, false if none is pending
+    bool TryRead(uint32_t& outEventId, size_t& outSize, bool& outFromSelf);
+
+    /// @brief Checks whether a message is waiting at the read position
+    bool HasPending() const;
+};
+
+/// @class EventBridge
+/// @brief Mirrors one Event across every process attached to a SharedEventChannel.
+///
+/// Local invocations of the event are published to the channel, and messages from other
+/// processes invoke the local event when the channel is polled. Messages delivered from the
+/// channel are not re-published, so mirroring the same event id in several processes is safe.
+///
+/// @tparam Args Argument types of the event; all must be trivially copyable and default constructible
+template<typename... Args>
+class EventBridge {
+public:
+    static_assert((std::is_trivially_copyable_v<std::decay_t<Args>> && ...),
+        "EventBridge payloads must be trivially copyable.");
+
+    // Enums
+
+    // Public Fields
+
+    /// @brief Size of the packed argument payload in bytes
+    static constexpr size_t PAYLOAD_SIZE = (size_t{0} + ... + sizeof(std::decay_t<Args>));
+
+    // Constructors and Destructors
+
+    /// @brief Starts mirroring an event
+    /// @param channel Channel to publish to and receive from; must outlive the bridge
+    /// @param eventId Identifier of this event on the channel, identical in every process
+    /// @param event The local event to mirror; must outlive the bridge
+    /// @throws std::length_error if the packed arguments do not fit in a channel slot
+    EventBridge(SharedEventChannel& channel, uint32_t eventId, Event<Args...>& event)
+        : _channel(channel), _eventId(eventId), _event(event)
+    {
+        if (PAYLOAD_SIZE > channel.SlotPayload())
+            throw std::length_error("EventBridge payload does not fit in a channel slot.");
+
+        _handle = _event.Add([this](Args... args) { Forward(args...); });
+        _channel.Subscribe(_eventId, [this](const uint8_t* data, size_t size) { Deliver(data, size); });
+    }
+
+    /// @brief Destructor. Stops mirroring in both directions.
+    ~EventBridge()
+    {
+        _channel.Unsubscribe(_eventId);
+        _event.Remove(_handle);
+    }
+
+    EventBridge(const EventBridge&) = delete;
+    EventBridge& operator=(const EventBridge&) = delete;
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    SharedEventChannel& _channel;
+    uint32_t _eventId;
+    Event<Args...>& _event;
+    typename Event<Args...>::Handle _handle{0};
+    bool _delivering{false};
+
+    // Private Methods
+
+    /// @brief Publishes a local invocation unless it is the echo of a delivered message
+    void Forward(const Args&... args)
+    {
+        if (_delivering) return;
+
+        std::array<uint8_t, PAYLOAD_SIZE + 1> payload;
+        size_t offset = 0;
+        ((std::memcpy(payload.data() + offset, &args, sizeof(std::decay_t<Args>)), offset += sizeof(std::decay_t<Args>)), ...);
+        _channel.Publish(_eventId, payload.data(), PAYLOAD_SIZE);
+    }
+
+    /// @brief Invokes the local event with a message received from another process
+    void Deliver(const uint8_t* data, size_t size)
+    {
+        if (size != PAYLOAD_SIZE) return;
+
+        std::tuple<std::decay_t<Args>...> values;
+        size_t offset = 0;
+        std::apply([&](auto&... value) {
+            ((std::memcpy(&value, data + offset, sizeof(value)), offset += sizeof(value)), ...);
+        }, values);
+
+        _delivering = true;
+        try
+        {
+            std::apply([this](auto&... value) { _event.Invoke(value...); }, values);
+        }
+        catch (...)
+        {
+            _delivering = false;
+            throw;
+        }
+        _delivering = false;
+    }
+};
+
+} // namespace velecs::common
@@ -0,0 +1,101 @@
+/// @file    StartupReadahead.hpp
+/// @author  Matthew Green
+/// @date    2026-10-18 17:31:05
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+
+namespace velecs::common {
+
+/// @class StartupReadahead
+/// @brief Records which asset files startup reads and prefetches them on the next launch.
+///
+/// While recording, loaders report the asset ranges they read through NoteAccess(); at
+/// EndStartup() the ordered list is saved to PersistentDataDir()/Startup/readahead.profile.
+/// When replaying, a background thread walks the saved list ahead of the main thread and asks
+/// the kernel to read each range into the page cache (readahead/posix_fadvise on POSIX, plain
+/// reads on Windows). Every launch appends its startup time and replay statistics to
+/// PersistentDataDir()/Startup/startup-report.csv, so cold, recorded and replayed launches can
+/// be compared. Requires Paths::Init().
+///
+/// @code
+/// Paths::Init("Company", "Game");
+/// StartupReadahead::BeginStartup(StartupReadahead::Mode::RecordAndReplay);
+///
+/// // In asset loaders
+/// StartupReadahead::NoteAccess(texturePath);
+///
+/// // When the first frame is ready
+/// StartupReadahead::EndStartup();
+/// @endcode
+class StartupReadahead {
+public:
+    // Enums
+
+    /// @brief What BeginStartup() should do
+    enum class Mode {
+        Off,             ///< Only time the startup for the report
+        Record,          ///< Record accesses and save a new profile
+        Replay,          ///< Prefetch the saved profile, if any
+        RecordAndReplay  ///< Prefetch the saved profile and record a fresh one
+    };
+
+    // Public Fields
+
+    // Constructors and Destructors
+
+    /// @brief Default constructor.
+    StartupReadahead() = default;
+
+    /// @brief Default deconstructor.
+    ~StartupReadahead() = default;
+
+    // Public Methods
+
+    /// @brief Starts timing startup and, depending on the mode, recording and prefetching
+    /// @param mode What to do during this startup
+    /// @throws std::runtime_error if Paths is not initialized or startup has already begun
+    static void BeginStartup(Mode mode);
+
+    /// @brief Reports that a loader read part of a file
+    /// @param file Absolute path of the file; files outside Paths::AssetsDir() are ignored
+    /// @param offset First byte read
+    /// @param length Number of bytes read, or 0 for the whole file
+    /// @note Thread-safe; a single relaxed load when not recording
+    static void NoteAccess(const std::filesystem::path& file, uint64_t offset = 0, uint64_t length = 0);
+
+    /// @brief Ends startup: stops prefetching, saves the recorded profile and appends to the report
+    /// @return Startup duration in milliseconds
+    static double EndStartup();
+
+    /// @brief Checks whether accesses are currently being recorded
+    static bool IsRecording();
+
+    /// @brief Gets the path of the saved profile
+    /// @throws std::runtime_error if Paths is not initialized
+    static std::filesystem::path ProfilePath();
+
+    /// @brief Gets the path of the timing report
+    /// @throws std::runtime_error if Paths is not initialized
+    static std::filesystem::path ReportPath();
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    // Private Methods
+};
+
+} // namespace velecs::common
@@ -0,0 +1,92 @@
+/// @file    StaticEvent.hpp
+/// @author  Matthew Green
+/// @date    2026-10-18 09:12:40
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+
+namespace velecs::common {
+
+/// @class StaticEvent
+/// @brief An event whose listener list is fixed at compile time.
+///
+/// The compile-time counterpart to Event for high-frequency internal hooks whose subscribers
+/// are known when the engine is built. Invoke() expands into a sequence of direct calls to the
+/// listed functions, so there is no std::function indirection, no vector walk and every call
+/// can be inlined. Use Event for anything that subscribes at runtime.
+///
+/// @tparam Signature Function signature of the event, e.g. void(int, float)
+/// @tparam Listeners Function pointers invoked in order on every Invoke()
+///
+/// @code
+/// void UpdateTransforms(float dt);
+/// void UpdateAudio(float dt);
+///
+/// using FrameTick = StaticEvent<void(float), &UpdateTransforms, &UpdateAudio>;
+/// FrameTick::Invoke(deltaTime);   // Calls UpdateTransforms(deltaTime), then UpdateAudio(deltaTime)
+///
+/// // Listener lists compose at compile time
+/// using DebugFrameTick = FrameTick::With<&DrawDebugOverlay>;
+/// @endcode
+template<typename Signature, auto... Listeners>
+class StaticEvent;
+
+template<typename... Args, auto... Listeners>
+class StaticEvent<void(Args...), Listeners...> {
+public:
+    static_assert((std::is_invocable_v<decltype(Listeners), Args...> && ...),
+        "Every listener must be callable with the event's argument types.");
+
+    // Enums
+
+    // Public Fields
+
+    /// @brief Type alias for a StaticEvent with additional listeners appended
+    /// @tparam MoreListeners Function pointers to invoke after the existing listeners
+    template<auto... MoreListeners>
+    using With = StaticEvent<void(Args...), Listeners..., MoreListeners...>;
+
+    // Constructors and Destructors
+
+    /// @brief Default constructor. A StaticEvent carries no state.
+    constexpr StaticEvent() = default;
+
+    // Public Methods
+
+    /// @brief Invokes every listener in declaration order with the provided arguments
+    /// @param args Arguments to pass to each listener
+    /// @note If a listener throws an exception, subsequent listeners will not be executed.
+    static void Invoke(Args... args)
+        noexcept((std::is_nothrow_invocable_v<decltype(Listeners), Args...> && ...))
+    {
+        (std::invoke(Listeners, args...), ...);
+    }
+
+    /// @brief Invokes every listener using function call operator
+    /// @param args Arguments to pass to each listener
+    /// @note Equivalent to Invoke(args...). Allows calling the event like a function: event(args...)
+    void operator()(Args... args) const
+        noexcept((std::is_nothrow_invocable_v<decltype(Listeners), Args...> && ...))
+    {
+        Invoke(args...);
+    }
+
+    /// @brief Checks if this event has no listeners
+    /// @return true if the listener list is empty
+    static constexpr bool Empty() { return sizeof...(Listeners) == 0; }
+
+    /// @brief Gets the number of listeners
+    /// @return The number of functions invoked by Invoke()
+    static constexpr size_t Size() { return sizeof...(Listeners); }
+};
+
+} // namespace velecs::common
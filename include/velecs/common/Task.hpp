@@ -0,0 +1,567 @@
+/// @file    Task.hpp
+/// @author  Matthew Green
+/// @date    2026-10-18 21:15:03
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+/// @brief 1 when velecs-common was built with VELECS_COMMON_COROUTINES=ON, which exports this definition
+/// @details Follows the library's build option rather than the consumer's language level, so a C++20
+///          consumer of a library built without coroutines gets no declarations it cannot link against.
+#ifndef VELECS_COROUTINES_ENABLED
+#define VELECS_COROUTINES_ENABLED 0
+#endif
+
+#if VELECS_COROUTINES_ENABLED
+#if !defined(__cpp_impl_coroutine) || !__has_include(<coroutine>)
+#error "velecs-common was built with VELECS_COMMON_COROUTINES=ON; code using it must compile as C++20."
+#endif
+#define VELECS_HAS_COROUTINES 1
+#else
+#define VELECS_HAS_COROUTINES 0
+#endif
+
+#if VELECS_HAS_COROUTINES
+
+#include <atomic>
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace velecs::common {
+
+/// @class FramePool
+/// @brief Size-classed, per-thread free lists for coroutine frames.
+///
+/// Every Task frame is allocated here. Frames up to MAX_POOLED_SIZE are rounded up to a 64-byte
+/// class and carry a small header naming the thread that allocated them. A frame freed on its
+/// allocating thread goes straight back to that thread's cache; one freed elsewhere is pushed onto
+/// the allocating thread's lock-free remote list, which that thread drains when its cache runs dry.
+/// A task started on the main thread and finished on a worker therefore refills the main thread's
+/// cache, and steady-state loads allocate nothing from the global heap once every cache holds its
+/// working set. Larger frames go straight to operator new.
+class FramePool {
+public:
+    // Enums
+
+    // Public Fields
+
+    /// @brief Granularity of the size classes
+    static constexpr size_t CLASS_SIZE = 64;
+
+    /// @brief Largest frame served from the pool
+    static constexpr size_t MAX_POOLED_SIZE = 4096;
+
+    /// @brief Bytes of free frames each thread keeps, headers included, before extras go back to the heap
+    static constexpr size_t MAX_CACHED_BYTES = 256 * 1024;
+
+    // Constructors and Destructors
+
+    /// @brief Default constructor.
+    FramePool() = default;
+
+    /// @brief Default deconstructor.
+    ~FramePool() = default;
+
+    // Public Methods
+
+    /// @brief Allocates a frame
+    /// @throws std::bad_alloc if the heap is exhausted
+    static void* Allocate(size_t size);
+
+    /// @brief Returns a frame
+    /// @param memory Pointer from Allocate()
+    /// @param size The size passed to Allocate()
+    static void Free(void* memory, size_t size) noexcept;
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    // Private Methods
+};
+
+template<typename T = void>
+class Task;
+
+namespace detail {
+
+/// @brief State shared by every Task promise: the awaiting coroutine and any escaped exception
+class TaskPromiseBase {
+public:
+    /// @brief Resumes the awaiting coroutine by symmetric transfer, so long await chains use no stack
+    /// @note Relies on the compiler emitting the transfer as a tail call; GCC does from -O2, so very deep
+    ///       synchronous chains can still overflow the stack in -O0/-O1 builds
+    struct FinalAwaiter {
+        bool await_ready() const noexcept { return false; }
+
+        template<typename Promise>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept
+        {
+            return handle.promise()._continuation;
+        }
+
+        void await_resume() const noexcept {}
+    };
+
+    /// @brief Tasks are lazy: nothing runs until the task is awaited
+    std::suspend_always initial_suspend() const noexcept { return {}; }
+    FinalAwaiter final_suspend() const noexcept { return {}; }
+    void unhandled_exception() noexcept { _exception = std::current_exception(); }
+
+    void SetContinuation(std::coroutine_handle<> continuation) noexcept { _continuation = continuation; }
+
+    static void* operator new(size_t size) { return FramePool::Allocate(size); }
+    static void operator delete(void* memory, size_t size) noexcept { FramePool::Free(memory, size); }
+
+protected:
+    void RethrowIfFailed() const
+    {
+        if (_exception) std::rethrow_exception(_exception);
+    }
+
+private:
+    std::coroutine_handle<> _continuation{std::noop_coroutine()};
+    std::exception_ptr _exception;
+};
+
+template<typename T>
+class TaskPromise final : public TaskPromiseBase {
+public:
+    Task<T> get_return_object() noexcept;
+
+    template<typename U>
+    void return_value(U&& value) { _value.emplace(std::forward<U>(value)); }
+
+    T Result()
+    {
+        RethrowIfFailed();
+        return std::move(*_value);
+    }
+
+private:
+    std::optional<T> _value;
+};
+
+template<>
+class TaskPromise<void> final : public TaskPromiseBase {
+public:
+    Task<void> get_return_object() noexcept;
+
+    void return_void() noexcept {}
+
+    void Result() { RethrowIfFailed(); }
+};
+
+/// @brief Fire-and-forget coroutine that starts immediately and frees its own frame when done
+struct DetachedTask {
+    struct promise_type {
+        DetachedTask get_return_object() noexcept { return {}; }
+        std::suspend_never initial_suspend() const noexcept { return {}; }
+        std::suspend_never final_suspend() const noexcept { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept { std::terminate(); }
+
+        static void* operator new(size_t size) { return FramePool::Allocate(size); }
+        static void operator delete(void* memory, size_t size) noexcept { FramePool::Free(memory, size); }
+    };
+};
+
+} // namespace detail
+
+/// @class Task
+/// @brief Lazily started coroutine producing a T, awaitable from other coroutines.
+///
+/// A Task does nothing until it is co_awaited; the awaiting coroutine resumes when it finishes,
+/// receiving its value or exception. Frames come from FramePool. Use CoroutineScheduler to move
+/// work onto worker threads or back to the main thread, and SyncWait() to block on a task from
+/// ordinary code.
+///
+/// @tparam T Result type, or void
+///
+/// @code
+/// Task<Mesh> LoadMesh(CoroutineScheduler& scheduler, std::string name)
+/// {
+///     std::vector<uint8_t> bytes = co_await ReadAssetAsync(scheduler, "meshes/" + name);
+///     co_return ParseMesh(bytes);
+/// }
+/// @endcode
+template<typename T>
+class Task {
+public:
+    // Enums
+
+    // Public Fields
+
+    using promise_type = detail::TaskPromise<T>;
+
+    // Constructors and Destructors
+
+    /// @brief Creates an empty task that holds no coroutine
+    Task() noexcept = default;
+
+    Task(Task&& other) noexcept : _handle(std::exchange(other._handle, {})) {}
+
+    Task& operator=(Task&& other) noexcept
+    {
+        if (this != &other)
+        {
+            if (_handle) _handle.destroy();
+            _handle = std::exchange(other._handle, {});
+        }
+        return *this;
+    }
+
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+
+    /// @brief Destroys the coroutine frame; a task must not be destroyed while it is running
+    ~Task()
+    {
+        if (_handle) _handle.destroy();
+    }
+
+    // Public Methods
+
+    /// @brief Checks whether the task holds a coroutine
+    bool Valid() const noexcept { return static_cast<bool>(_handle); }
+
+    /// @brief Checks whether the coroutine has finished
+    bool Done() const noexcept { return _handle && _handle.done(); }
+
+    /// @throws std::logic_error if the task is empty (default-constructed or moved from)
+    bool await_ready() const
+    {
+        if (!_handle) throw std::logic_error("Cannot await an empty Task.");
+        return _handle.done();
+    }
+
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept
+    {
+        _handle.promise().SetContinuation(awaiting);
+        return _handle;
+    }
+
+    T await_resume() { return _handle.promise().Result(); }
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    friend class detail::TaskPromise<T>;
+
+    // Private Fields
+
+    std::coroutine_handle<promise_type> _handle;
+
+    // Private Methods
+
+    explicit Task(std::coroutine_handle<promise_type> handle) noexcept : _handle(handle) {}
+};
+
+namespace detail {
+
+template<typename T>
+Task<T> TaskPromise<T>::get_return_object() noexcept
+{
+    return Task<T>{std::coroutine_handle<TaskPromise<T>>::from_promise(*this)};
+}
+
+inline Task<void> TaskPromise<void>::get_return_object() noexcept
+{
+    return Task<void>{std::coroutine_handle<TaskPromise<void>>::from_promise(*this)};
+}
+
+/// @brief One-shot flag a plain thread can block on
+class BlockingEvent {
+public:
+    void Set()
+    {
+        // Notify under the lock so the waiter cannot return and destroy this before notify_all() finishes
+        std::lock_guard<std::mutex> lock(_mutex);
+        _set = true;
+        _cv.notify_all();
+    }
+
+    void Wait()
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _cv.wait(lock, [this] { return _set; });
+    }
+
+private:
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    bool _set{false};
+};
+
+template<typename T>
+DetachedTask RunAndSignal(Task<T> task, std::optional<T>& result, std::exception_ptr& error, BlockingEvent& event)
+{
+    try
+    {
+        result.emplace(co_await task);
+    }
+    catch (...)
+    {
+        error = std::current_exception();
+    }
+    event.Set();
+}
+
+inline DetachedTask RunAndSignal(Task<void> task, std::exception_ptr& error, BlockingEvent& event)
+{
+    try
+    {
+        co_await task;
+    }
+    catch (...)
+    {
+        error = std::current_exception();
+    }
+    event.Set();
+}
+
+/// @brief Countdown shared by WhenAll() and its children; the count includes one for the starter
+struct WhenAllState {
+    explicit WhenAllState(size_t count) : remaining(count + 1) {}
+
+    std::atomic<size_t> remaining;
+    std::coroutine_handle<> parent;
+    std::exception_ptr error;
+    std::mutex errorMutex;
+
+    void Fail(std::exception_ptr exception)
+    {
+        std::lock_guard<std::mutex> lock(errorMutex);
+        if (!error) error = exception;
+    }
+
+    void Arrive()
+    {
+        if (remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) parent.resume();
+    }
+};
+
+template<typename T>
+DetachedTask WhenAllChild(Task<T> task, WhenAllState& state, std::optional<T>& slot)
+{
+    try
+    {
+        slot.emplace(co_await task);
+    }
+    catch (...)
+    {
+        state.Fail(std::current_exception());
+    }
+    state.Arrive();
+}
+
+inline DetachedTask WhenAllChild(Task<void> task, WhenAllState& state)
+{
+    try
+    {
+        co_await task;
+    }
+    catch (...)
+    {
+        state.Fail(std::current_exception());
+    }
+    state.Arrive();
+}
+
+/// @brief Starts every child when the parent suspends; resumes the parent after the last one finishes
+template<typename Start>
+struct WhenAllAwaiter {
+    WhenAllState& state;
+    Start start;
+
+    bool await_ready() const noexcept { return false; }
+
+    bool await_suspend(std::coroutine_handle<> parent)
+    {
+        state.parent = parent;
+        start();
+        // Drop the starter's count; if every child already finished, continue without suspending
+        return state.remaining.fetch_sub(1, std::memory_order_acq_rel) != 1;
+    }
+
+    void await_resume() const noexcept {}
+};
+
+/// @brief Shared by WhenAny() and its children; children that lose keep it alive until they finish
+template<typename T>
+struct WhenAnyState {
+    std::atomic<bool> decided{false};
+
+    /// @brief Two arrivals resume the parent: the winner and the starter leaving await_suspend
+    std::atomic<int> gate{2};
+
+    std::coroutine_handle<> parent;
+    size_t index{0};
+    std::conditional_t<std::is_void_v<T>, bool, std::optional<T>> value{};
+    std::exception_ptr error;
+
+    bool Pass() { return gate.fetch_sub(1, std::memory_order_acq_rel) == 1; }
+};
+
+template<typename T>
+DetachedTask WhenAnyChild(Task<T> task, std::shared_ptr<WhenAnyState<T>> state, size_t index)
+{
+    std::exception_ptr error;
+    std::optional<std::conditional_t<std::is_void_v<T>, bool, T>> value;
+    try
+    {
+        if constexpr (std::is_void_v<T>)
+        {
+            co_await task;
+            value.emplace(true);
+        }
+        else
+        {
+            value.emplace(co_await task);
+        }
+    }
+    catch (...)
+    {
+        error = std::current_exception();
+    }
+
+    if (state->decided.exchange(true, std::memory_order_acq_rel)) co_return;
+
+    state->index = index;
+    state->error = error;
+    if constexpr (!std::is_void_v<T>)
+    {
+        if (value) state->value.emplace(std::move(*value));
+    }
+    if (state->Pass()) state->parent.resume();
+}
+
+/// @note Holds references only: GCC 12 can destroy awaiter temporaries with non-trivial members twice
+template<typename T>
+struct WhenAnyAwaiter {
+    const std::shared_ptr<WhenAnyState<T>>& state;
+    std::vector<Task<T>>& tasks;
+
+    bool await_ready() const noexcept { return false; }
+
+    bool await_suspend(std::coroutine_handle<> parent)
+    {
+        state->parent = parent;
+        for (size_t i = 0; i < tasks.size(); ++i)
+        {
+            WhenAnyChild(std::move(tasks[i]), state, i);
+        }
+        return !state->Pass();
+    }
+
+    void await_resume() const noexcept {}
+};
+
+} // namespace detail
+
+/// @brief Runs a task to completion from ordinary (non-coroutine) code, blocking the calling thread
+/// @param task Task to run; it starts on the calling thread
+/// @return The task's value
+/// @throws Whatever the task threw
+/// @warning Do not call from a thread the task needs in order to finish, e.g. the thread that
+///          drains a ThreadExecutor the task resumes on
+template<typename T>
+T SyncWait(Task<T> task)
+{
+    detail::BlockingEvent event;
+    std::exception_ptr error;
+    if constexpr (std::is_void_v<T>)
+    {
+        detail::RunAndSignal(std::move(task), error, event);
+        event.Wait();
+        if (error) std::rethrow_exception(error);
+    }
+    else
+    {
+        std::optional<T> result;
+        detail::RunAndSignal(std::move(task), result, error, event);
+        event.Wait();
+        if (error) std::rethrow_exception(error);
+        return std::move(*result);
+    }
+}
+
+/// @brief Runs tasks concurrently and waits for all of them
+/// @param tasks Tasks to run; each starts on the awaiting thread and runs until its first suspension
+/// @return The results in the order of tasks (nothing for Task<void>)
+/// @throws The first exception any task threw, after every task has finished
+template<typename T>
+Task<std::conditional_t<std::is_void_v<T>, void, std::vector<T>>> WhenAll(std::vector<Task<T>> tasks)
+{
+    detail::WhenAllState state(tasks.size());
+
+    if constexpr (std::is_void_v<T>)
+    {
+        co_await detail::WhenAllAwaiter{state, [&] {
+            for (auto& task : tasks) detail::WhenAllChild(std::move(task), state);
+        }};
+        if (state.error) std::rethrow_exception(state.error);
+    }
+    else
+    {
+        std::vector<std::optional<T>> slots(tasks.size());
+        co_await detail::WhenAllAwaiter{state, [&] {
+            for (size_t i = 0; i < tasks.size(); ++i) detail::WhenAllChild(std::move(tasks[i]), state, slots[i]);
+        }};
+        if (state.error) std::rethrow_exception(state.error);
+
+        std::vector<T> results;
+        results.reserve(slots.size());
+        for (auto& slot : slots) results.push_back(std::move(*slot));
+        co_return results;
+    }
+}
+
+/// @brief Runs tasks concurrently and resumes as soon as the first one finishes
+/// @param tasks Tasks to run. The others keep running to completion in the background.
+/// @return Index of the first task to finish and its value (just the index for Task<void>)
+/// @throws std::invalid_argument if tasks is empty
+/// @throws The exception of the first task to finish, if it threw
+template<typename T>
+Task<std::conditional_t<std::is_void_v<T>, size_t, std::pair<size_t, T>>> WhenAny(std::vector<Task<T>> tasks)
+{
+    if (tasks.empty()) throw std::invalid_argument("WhenAny() needs at least one task");
+
+    auto state = std::make_shared<detail::WhenAnyState<T>>();
+    co_await detail::WhenAnyAwaiter<T>{state, tasks};
+    if (state->error) std::rethrow_exception(state->error);
+
+    if constexpr (std::is_void_v<T>)
+    {
+        co_return state->index;
+    }
+    else
+    {
+        co_return std::pair<size_t, T>(state->index, std::move(*state->value));
+    }
+}
+
+} // namespace velecs::common
+
+#endif // VELECS_HAS_COROUTINES
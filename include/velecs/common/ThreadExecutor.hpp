@@ -0,0 +1,123 @@
+/// @file    ThreadExecutor.hpp
+/// @author  Matthew Green
+/// @date    2026-10-18 13:21:52
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <thread>
+
+namespace velecs::common {
+
+/// @class ThreadExecutor
+/// @brief Lock-free inbox of work that a single owning thread drains, e.g. once per frame.
+///
+/// Any thread may post tasks; only the owning thread runs them, in the order they were posted,
+/// when it calls Drain(). Posting is a single compare-and-swap with no mutex. Used by Event to
+/// deliver thread-affine listeners on the thread that subscribed them.
+///
+/// @code
+/// ThreadExecutor renderInbox;  // Constructed on the render thread
+///
+/// // Any thread
+/// renderInbox.Post([] { UploadTexture(); });
+///
+/// // Render thread, once per frame
+/// renderInbox.Drain();
+/// @endcode
+class ThreadExecutor {
+public:
+    // Enums
+
+    // Public Fields
+
+    /// @brief Unit of work queued in an executor's inbox
+    class Task {
+    public:
+        virtual ~Task() = default;
+
+        /// @brief Runs the task on the executor's owning thread
+        virtual void Run() = 0;
+
+    private:
+        friend class ThreadExecutor;
+
+        Task* _next{nullptr};
+    };
+
+    // Constructors and Destructors
+
+    /// @brief Creates an executor owned by the calling thread
+    ThreadExecutor();
+
+    /// @brief Destructor. Discards pending tasks without running them.
+    ~ThreadExecutor();
+
+    ThreadExecutor(const ThreadExecutor&) = delete;
+    ThreadExecutor& operator=(const ThreadExecutor&) = delete;
+
+    // Public Methods
+
+    /// @brief Queues a task to run on the owning thread
+    /// @param task Task to run; ownership passes to the executor
+    /// @note Thread-safe and lock-free
+    void Post(std::unique_ptr<Task> task);
+
+    /// @brief Queues a function to run on the owning thread
+    /// @param function Function to run
+    /// @note Thread-safe and lock-free
+    void Post(std::function<void()> function);
+
+    /// @brief Runs every task posted so far, oldest first
+    /// @return Number of tasks run
+    /// @note Must only be called from the owning thread. Tasks posted while draining run on the next call.
+    ///       If a task throws, the tasks behind it stay queued for the next call.
+    size_t Drain();
+
+    /// @brief Checks whether any task is waiting to be drained
+    /// @return true if the inbox is empty at the time of the call
+    /// @note Tasks left over from a Drain() that threw are only seen by the owning thread
+    bool Empty() const
+    {
+        if (_head.load(std::memory_order_acquire) != nullptr) return false;
+        return !IsOwnerThread() || _pending == nullptr;
+    }
+
+    /// @brief Makes the calling thread the owner of this executor
+    void BindToCurrentThread() { _owner.store(std::this_thread::get_id(), std::memory_order_release); }
+
+    /// @brief Checks whether the calling thread owns this executor
+    /// @return true when called from the thread that drains this executor
+    bool IsOwnerThread() const { return _owner.load(std::memory_order_acquire) == std::this_thread::get_id(); }
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    /// @brief Most recently posted task; tasks are linked newest to oldest
+    std::atomic<Task*> _head{nullptr};
+
+    /// @brief Tasks taken from the inbox but not yet run, oldest first (owner thread only)
+    Task* _pending{nullptr};
+
+    std::atomic<std::thread::id> _owner;
+
+    // Private Methods
+
+    /// @brief Deletes every task in a linked list
+    static void DeleteList(Task* list);
+};
+
+} // namespace velecs::common
@@ -0,0 +1,202 @@
+/// @file    TieredCache.hpp
+/// @author  Matthew Green
+/// @date    2026-10-18 18:02:44
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/common/Paths.hpp"
+
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace velecs::common {
+
+/// @class TieredCache
+/// @brief File cache that keeps hot entries in Paths' fast (RAM-backed) tier and all entries in the durable tier.
+///
+/// Entries live as files under Paths::CacheDir(Durable)/{name}. An entry read often enough is
+/// promoted: copied into Paths::CacheDir(Fast)/{name} so later reads come from RAM. Writes land in
+/// the fast tier and are written back to the durable tier by a background thread. When the fast
+/// tier exceeds its byte budget, the least recently used clean entries are dropped from RAM; dirty
+/// ones are handed to the write-back thread and dropped once written, so the budget can be exceeded
+/// briefly. Write-back copies run without holding the lock that Put() and TryGet() take.
+///
+/// @code
+/// TieredCache shaders("Shaders");
+/// shaders.Put(hash, compiledBytes);
+///
+/// std::vector<uint8_t> bytes;
+/// if (shaders.TryGet(hash, bytes)) { ... }
+/// @endcode
+class TieredCache {
+public:
+    // Enums
+
+    // Public Fields
+
+    /// @brief Promotion, demotion and write-back tuning
+    struct Options {
+        /// @brief Reads of a durable-only entry before it is promoted to the fast tier
+        uint32_t promoteAfterReads{2};
+
+        /// @brief Byte budget of the fast tier for this cache
+        uint64_t fastCapacityBytes{256ull * 1024 * 1024};
+
+        /// @brief Longest time a write stays only in the fast tier
+        std::chrono::milliseconds writeBackDelay{std::chrono::milliseconds(500)};
+    };
+
+    // Constructors and Destructors
+
+    /// @brief Opens a cache with default options
+    /// @param name Cache name, used as the directory name in both tiers
+    /// @throws std::runtime_error if Paths is not initialized
+    explicit TieredCache(const std::string& name);
+
+    /// @brief Opens a cache
+    /// @param name Cache name, used as the directory name in both tiers
+    /// @param options Promotion, demotion and write-back tuning
+    /// @throws std::runtime_error if Paths is not initialized
+    TieredCache(const std::string& name, const Options& options);
+
+    /// @brief Destructor. Writes back every pending entry, then stops the write-back thread.
+    ~TieredCache();
+
+    TieredCache(const TieredCache&) = delete;
+    TieredCache& operator=(const TieredCache&) = delete;
+
+    // Public Methods
+
+    /// @brief Stores an entry
+    /// @param key Entry key; any string
+    /// @param data Entry bytes
+    /// @param size Number of bytes
+    /// @throws std::runtime_error if the entry cannot be written to either tier
+    void Put(const std::string& key, const void* data, size_t size);
+
+    /// @brief Stores an entry
+    void Put(const std::string& key, const std::vector<uint8_t>& value) { Put(key, value.data(), value.size()); }
+
+    /// @brief Reads an entry, from the fast tier when it is there
+    /// @param key Entry key
+    /// @param outValue Receives the entry bytes if found
+    /// @return true if the entry exists in either tier
+    bool TryGet(const std::string& key, std::vector<uint8_t>& outValue);
+
+    /// @brief Reads an entry, from the fast tier when it is there
+    /// @param key Entry key
+    /// @return The entry bytes, or std::nullopt if the entry does not exist
+    std::optional<std::vector<uint8_t>> Get(const std::string& key);
+
+    /// @brief Removes an entry from both tiers
+    /// @param key Entry key
+    void Remove(const std::string& key);
+
+    /// @brief Writes every pending fast-tier entry back to the durable tier now
+    /// @note Entries that fail to write back stay pending and are retried by the write-back thread
+    void Flush();
+
+    /// @brief Checks whether an entry is currently held in the fast tier
+    bool IsInFastTier(const std::string& key) const;
+
+    /// @brief Gets the bytes currently held in the fast tier
+    uint64_t FastTierBytes() const;
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    /// @brief Bookkeeping for an entry seen by this process
+    struct Entry {
+        uint32_t reads{0};
+        bool inFast{false};
+        bool dirty{false};
+        uint64_t size{0};
+
+        /// @brief Bumped whenever the fast copy is replaced, so a write-back of an older copy is discarded
+        uint64_t version{0};
+
+        std::chrono::steady_clock::time_point dirtySince;
+        std::list<std::string>::iterator lruPosition;
+    };
+
+    // Private Fields
+
+    Options _options;
+    std::filesystem::path _fastDir;
+    std::filesystem::path _durableDir;
+    bool _hasFastTier{false};
+
+    mutable std::mutex _mutex;
+    std::unordered_map<std::string, Entry> _entries;
+
+    /// @brief Fast-tier entries, most recently used first
+    std::list<std::string> _lru;
+    uint64_t _fastBytes{0};
+
+    /// @brief Bumped by every Put and Remove of the keys hashing to each slot (lock held)
+    /// @details TryGet reads the durable copy without the lock and promotes it only if its key's slot is
+    ///          unchanged, so a Remove or Put in that window is never undone by the promotion.
+    std::array<uint64_t, 64> _mutationGenerations{};
+
+    /// @brief Serializes write-back passes and durable-only Puts; taken before _mutex, never while holding it
+    std::mutex _writeBackMutex;
+
+    std::condition_variable _writeBackCv;
+    bool _stopWriteBack{false};
+
+    /// @brief Set when eviction had to skip dirty entries; wakes the write-back thread early
+    bool _evictionPending{false};
+    std::thread _writeBackThread;
+
+    // Private Methods
+
+    /// @brief Maps a key to a portable file name
+    static std::string FileNameFor(const std::string& key);
+
+    /// @brief Inverts FileNameFor
+    /// @return The key, or std::nullopt if FileNameFor produces no such name
+    static std::optional<std::string> KeyForFileName(const std::string& fileName);
+
+    /// @brief Gets the mutation generation slot of a key (lock held)
+    uint64_t& MutationGeneration(const std::string& key);
+
+    /// @brief Copies an entry into the fast tier and evicts as needed (lock held)
+    /// @return false if the fast tier could not take the copy; the entry is left unchanged
+    bool StoreInFastTier(const std::string& key, Entry& entry, const void* data, size_t size, bool dirty);
+
+    /// @brief Writes an entry to the durable tier only and drops any fast copy (lock not held)
+    /// @throws std::runtime_error if the file cannot be written
+    void PutDurable(const std::string& key, const std::string& fileName, const void* data, size_t size);
+
+    /// @brief Drops least recently used clean entries until the fast tier fits its budget (lock held)
+    /// @param requestWriteBack Wake the write-back thread if dirty entries kept the tier over budget
+    void EnforceFastCapacity(bool requestWriteBack);
+
+    /// @brief Writes dirty entries back to the durable tier, copying outside the lock (lock not held)
+    /// @param cutoff Only entries dirty since at or before this time are written
+    void WriteBackDirty(std::chrono::steady_clock::time_point cutoff);
+
+    /// @brief Body of the write-back thread
+    void WriteBackLoop();
+};
+
+} // namespace velecs::common
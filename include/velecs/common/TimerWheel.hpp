@@ -0,0 +1,233 @@
+/// @file    TimerWheel.hpp
+/// @author  Matthew Green
+/// @date    2026-10-18 11:37:14
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/common/Event.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace velecs::common {
+
+/// @class TimerWheel
+/// @brief Hierarchical timing wheel for delayed and periodic callbacks.
+///
+/// Four levels of 256 slots cover 2^32 ticks; timers further out are parked in the outermost
+/// level and re-placed as the wheel turns. Scheduling and cancelling are O(1) and advancing
+/// is amortized O(1) per tick regardless of how many timers are pending, which replaces
+/// per-frame scans of sorted timer lists.
+///
+/// Handles are size_t values like Event::Handle: never 0, and never reused while the
+/// timer they identify is pending.
+///
+/// @code
+/// TimerWheel timers(std::chrono::milliseconds(1));
+///
+/// auto spawn = timers.ScheduleInvoke(std::chrono::milliseconds(2500), onSpawn, enemyId);
+/// auto poll  = timers.SchedulePeriodic(std::chrono::milliseconds(100), [] { PollInput(); });
+///
+/// // Each frame
+/// timers.Advance(frameDelta);
+///
+/// timers.Cancel(poll);
+/// @endcode
+class TimerWheel {
+public:
+    // Enums
+
+    // Public Fields
+
+    /// @brief Type alias for timer callbacks
+    using Callback = std::function<void()>;
+
+    /// @brief Handle type returned when scheduling, used for cancellation
+    using Handle = Event<>::Handle;
+
+    /// @brief Duration type used for delays and intervals
+    using Duration = std::chrono::nanoseconds;
+
+    // Constructors and Destructors
+
+    /// @brief Constructor
+    /// @param tickDuration Resolution of the wheel; timers fire on the first tick at or after their deadline
+    /// @throws std::invalid_argument if tickDuration is not positive
+    explicit TimerWheel(Duration tickDuration = std::chrono::milliseconds(1));
+
+    /// @brief Default destructor. Pending timers are discarded without firing.
+    ~TimerWheel() = default;
+
+    TimerWheel(const TimerWheel&) = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+
+    // Public Methods
+
+    /// @brief Schedules a callback to run once after a delay
+    /// @param delay Time from now until the callback fires; rounded up to whole ticks, minimum one
+    /// @param callback Function to call
+    /// @return Handle that can be used to cancel the timer
+    Handle Schedule(Duration delay, Callback callback);
+
+    /// @brief Schedules a callback to run repeatedly
+    /// @param interval Time between firings; the first firing is one interval from now
+    /// @param callback Function to call
+    /// @return Handle that can be used to cancel the timer
+    /// @note Deadlines advance by exactly one interval per firing, so periodic timers do not drift
+    Handle SchedulePeriodic(Duration interval, Callback callback);
+
+    /// @brief Schedules an event to be invoked once after a delay
+    /// @tparam Args Argument types of the event
+    /// @tparam Values Types of the stored arguments
+    /// @param delay Time from now until the event is invoked
+    /// @param event The event to invoke; must outlive the timer
+    /// @param args Arguments to invoke the event with, copied into the timer
+    /// @return Handle that can be used to cancel the timer
+    template<typename... Args, typename... Values>
+    Handle ScheduleInvoke(Duration delay, Event<Args...>& event, Values&&... args)
+    {
+        return Schedule(delay, MakeInvoker(event, std::forward<Values>(args)...));
+    }
+
+    /// @brief Schedules an event to be invoked repeatedly
+    /// @tparam Args Argument types of the event
+    /// @tparam Values Types of the stored arguments
+    /// @param interval Time between invocations
+    /// @param event The event to invoke; must outlive the timer
+    /// @param args Arguments to invoke the event with, copied into the timer
+    /// @return Handle that can be used to cancel the timer
+    template<typename... Args, typename... Values>
+    Handle ScheduleInvokePeriodic(Duration interval, Event<Args...>& event, Values&&... args)
+    {
+        return SchedulePeriodic(interval, MakeInvoker(event, std::forward<Values>(args)...));
+    }
+
+    /// @brief Cancels a pending timer
+    /// @param handle The handle returned when the timer was scheduled
+    /// @return true if the timer was pending (or currently firing) and is now cancelled
+    /// @note Safe to call from inside a timer callback, including for the firing timer itself
+    bool Cancel(Handle handle);
+
+    /// @brief Checks whether a timer is still pending
+    /// @param handle The handle returned when the timer was scheduled
+    /// @return true if the timer will fire again
+    bool IsScheduled(Handle handle) const;
+
+    /// @brief Advances the wheel, firing every timer whose deadline has been reached
+    /// @param elapsed Time since the previous call; fractions of a tick carry over
+    /// @return Number of callbacks invoked
+    /// @throws std::logic_error if called from inside a timer callback
+    size_t Advance(Duration elapsed);
+
+    /// @brief Removes all pending timers without firing them
+    void Clear();
+
+    /// @brief Gets the number of pending timers
+    /// @return Number of timers that will fire again
+    size_t Size() const { return _scheduledCount; }
+
+    /// @brief Checks if no timers are pending
+    /// @return true if no timers are pending
+    bool Empty() const { return _scheduledCount == 0; }
+
+    /// @brief Gets the resolution of the wheel
+    /// @return Duration of one tick
+    Duration TickDuration() const { return _tickDuration; }
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    static constexpr uint32_t SLOT_BITS = 8;
+    static constexpr uint32_t SLOT_COUNT = 1u << SLOT_BITS;
+    static constexpr uint32_t SLOT_MASK = SLOT_COUNT - 1;
+    static constexpr uint32_t LEVEL_COUNT = 4;
+    static constexpr uint64_t MAX_TICK_DELTA = (uint64_t{1} << (SLOT_BITS * LEVEL_COUNT)) - 1;
+    static constexpr uint32_t NIL = 0xFFFFFFFFu;
+
+    /// @brief Lifecycle of a timer node
+    enum class NodeState : uint8_t {
+        Free,
+        Scheduled,
+        Firing,
+        Cancelled
+    };
+
+    /// @brief Timer record, linked into a slot through node indices
+    struct Node {
+        uint64_t expiry{0};
+        uint64_t periodTicks{0};
+        uint32_t prev{NIL};
+        uint32_t next{NIL};
+        uint32_t slot{NIL};
+        uint32_t generation{1};
+        NodeState state{NodeState::Free};
+        Callback callback;
+    };
+
+    Duration _tickDuration;
+    Duration _carry{0};
+    uint64_t _currentTick{0};
+    size_t _scheduledCount{0};
+    bool _advancing{false};
+
+    std::vector<Node> _nodes;
+    std::vector<uint32_t> _freeNodes;
+    std::array<uint32_t, SLOT_COUNT * LEVEL_COUNT> _slots;
+    std::array<uint32_t, SLOT_COUNT * LEVEL_COUNT> _slotTails;
+    std::vector<uint32_t> _expired;
+
+    // Private Methods
+
+    /// @brief Wraps an event and its arguments in a timer callback
+    template<typename... Args, typename... Values>
+    static Callback MakeInvoker(Event<Args...>& event, Values&&... args)
+    {
+        return [&event, stored = std::make_tuple(std::forward<Values>(args)...)]() {
+            std::apply([&event](const auto&... unpacked) { event.Invoke(unpacked...); }, stored);
+        };
+    }
+
+    /// @brief Allocates a node and links it at its deadline
+    Handle Insert(uint64_t delayTicks, uint64_t periodTicks, Callback callback);
+
+    /// @brief Converts a duration to ticks, rounding up so timers never fire early
+    uint64_t ToTicks(Duration duration) const;
+
+    /// @brief Links a node at the tail of the slot matching its expiry, so equal deadlines fire in scheduling order
+    void Link(uint32_t index);
+
+    /// @brief Unlinks a node from its slot
+    void Unlink(uint32_t index);
+
+    /// @brief Returns a node to the free list, invalidating its handle
+    void Release(uint32_t index);
+
+    /// @brief Re-places every node of an outer slot into finer slots
+    /// @return The slot index that was cascaded, so the caller knows whether to cascade further
+    uint32_t Cascade(uint32_t level);
+
+    /// @brief Cascades outer levels as needed and fires every timer due at the current tick
+    /// @return Number of callbacks invoked
+    size_t ProcessTick();
+
+    /// @brief Decodes a handle into a node index if it refers to a live timer
+    bool Resolve(Handle handle, uint32_t& outIndex) const;
+};
+
+} // namespace velecs::common
@@ -10,19 +10,21 @@
 
 #pragma once
 
-#include <uuid.h> // `#include <stduuid/include/uuid.h>` does not work unfortunately.
-
-#include <string>
-#include <iostream>
-#include <optional>
-#include <functional>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <typeindex> // Smallest standard header that declares the std::hash primary template
 
 namespace velecs::common {
 
 /// @class Uuid
-/// @brief Brief description.
+/// @brief A 16-byte universally unique identifier.
 ///
-/// Rest of description.
+/// A trivially copyable value type holding the bytes in canonical (big-endian, string) order.
+/// This header only declares the value type, comparison, hashing and the binary generators, and
+/// pulls in no <string> or <optional>. Parsing, formatting and name-based generation live in
+/// UuidString.hpp and stream output in UuidStream.hpp, so including Uuid.hpp stays cheap for every
+/// translation unit that handles IDs.
 class Uuid {
 public:
     // Enums
@@ -32,19 +34,22 @@ public:
     /// @brief Static constant representing an invalid/null UUID (all zeros)
     static const Uuid INVALID;
 
+    /// @brief Bits of node ID embedded by GenerateNodeOrdered()
+    static constexpr unsigned NODE_ID_BITS = 58;
+
     // Constructors and Destructors
 
     /// @brief Default constructor is deleted - use factory methods instead
-    /// @note Forces explicit creation through GenerateRandom() or FromString()
+    /// @note Forces explicit creation through GenerateRandom(), FromBytes() or UuidString::FromString()
     Uuid() = delete;
 
     /// @brief Copy constructor
     /// @param other The UUID to copy from
-    inline Uuid(const Uuid& other) : _uuid(other._uuid) {}
+    constexpr Uuid(const Uuid& other) = default;
 
     /// @brief Move constructor
     /// @param other The UUID to move from
-    inline Uuid(Uuid&& other) noexcept : _uuid(std::move(other._uuid)) {}
+    constexpr Uuid(Uuid&& other) noexcept = default;
 
     /// @brief Default destructor
     ~Uuid() = default;
@@ -54,81 +59,97 @@ public:
     /// @brief Generate a new random UUID (version 4)
     /// @return A new random UUID following RFC 4122 standards
     /// @note This method is thread-safe and uses proper entropy seeding
+    /// @note Each thread's generator is seeded from EntropyPool on first use, without a system call
+    ///       unless the pool needs refilling
     static Uuid GenerateRandom();
 
+    /// @brief Seed the calling thread's GenerateRandom() generator now instead of on first use
+    /// @note Call from thread-pool workers at startup, after EntropyPool::Reserve(), to keep seeding
+    ///       off the first GenerateRandom() call
+    static void SeedCurrentThread();
+
     /// @brief Generate sequential UUIDs for testing/debugging purposes
     /// @return A UUID with an incrementing counter in the least significant bits
     /// @note Thread-safe using atomic counter. Format: 00000000-0000-0000-XXXX-XXXXXXXXXXXX
     /// @warning Not cryptographically secure - only use for testing/debugging!
     static Uuid GenerateSequential();
 
+    /// @brief Generate a time-ordered UUID that is unique across processes without coordination
+    /// @return A version 8 UUID laid out as 48-bit Unix milliseconds | 16-bit counter | 58-bit node ID
+    /// @note Lock-free: one compare-and-swap on a process-wide word. Monotonic per node, even if the
+    ///       system clock steps backwards; past 65536 IDs in a millisecond the counter borrows the next
+    ///       millisecond. IDs from every node sort by creation millisecond, so merged datasets stay ordered.
+    /// @note Unique as long as node IDs are; see SetNodeId()
+    static Uuid GenerateNodeOrdered();
+
+    /// @brief Set the node ID embedded by GenerateNodeOrdered()
+    /// @param nodeId Identifier unique among all processes whose IDs will be merged, below 2^NODE_ID_BITS
+    /// @throws std::invalid_argument if nodeId does not fit in NODE_ID_BITS bits
+    /// @note When never set, the node ID is derived from the host name, the process ID and 64 bits of
+    ///       kernel entropy, so colliding processes are astronomically unlikely. A forked child derives
+    ///       a new one; an explicit ID is inherited and should be reset in the child.
+    static void SetNodeId(uint64_t nodeId);
+
+    /// @brief Get the node ID embedded by GenerateNodeOrdered()
+    /// @return The configured node ID, or the derived default
+    static uint64_t GetNodeId();
+
     /// @brief Generate a deterministic UUID from a numeric seed
     /// @param seed The numeric seed for deterministic generation (32-bit)
     /// @return A UUID that's always the same for the same seed value
     /// @note Uses Mersenne Twister engine seeded with the provided value
     static Uuid GenerateFromSeed(uint32_t seed);
 
-    /// @brief Generate a deterministic UUID from a string seed (name-based UUID v5)
-    /// @param seed The string seed (any length, e.g., "MyGameWorld123")
-    /// @return A UUID that's always the same for the same seed string
-    /// @note Uses SHA-1 hashing with velecs namespace. Same input always produces same output
-    static Uuid GenerateFromString(const std::string& seed);
-
-    /// @brief Generate a deterministic UUID by hashing string to numeric seed
-    /// @param seed The string seed to hash into a numeric value
-    /// @return A UUID generated from the hashed numeric seed
-    /// @note Hashes string to size_t, then truncates to uint32_t for GenerateFromSeed()
-    /// @warning Different from GenerateFromString() - may have hash collisions
-    static Uuid GenerateFromStringHash(const std::string& seed);
-
-    /// @brief Parse a UUID from a string representation
-    /// @param uuid The UUID string in canonical format (e.g., "550e8400-e29b-41d4-a716-446655440000")
-    /// @return A new UUID object, or INVALID if parsing failed
-    /// @note Accepts both uppercase and lowercase hex digits, with or without hyphens
-    static std::optional<Uuid> FromString(const std::string& uuid);
+    /// @brief Create a UUID from its 16 raw bytes
+    /// @param bytes The bytes in canonical (big-endian, string) order
+    /// @return A UUID holding exactly these bytes
+    static constexpr Uuid FromBytes(const std::array<uint8_t, 16>& bytes) { return Uuid{bytes}; }
 
     /// @brief Copy assignment operator
     /// @param other The UUID to copy from
     /// @return Reference to this UUID
-    Uuid& operator=(const Uuid& other);
+    Uuid& operator=(const Uuid& other) = default;
 
     /// @brief Move assignment operator
     /// @param other The UUID to move from
     /// @return Reference to this UUID
-    Uuid& operator=(Uuid&& other) noexcept;
+    Uuid& operator=(Uuid&& other) noexcept = default;
 
     /// @brief Equality comparison operator
     /// @param other The UUID to compare against
     /// @return true if both UUIDs are identical
-    inline bool operator==(const Uuid& other) const { return _uuid == other._uuid; }
+    inline bool operator==(const Uuid& other) const { return _bytes == other._bytes; }
 
     /// @brief Inequality comparison operator
     /// @param other The UUID to compare against
     /// @return true if UUIDs are different
-    inline bool operator!=(const Uuid& other) const { return _uuid != other._uuid; }
+    inline bool operator!=(const Uuid& other) const { return _bytes != other._bytes; }
+
+    /// @brief Ordering comparison operator
+    /// @param other The UUID to compare against
+    /// @return true if this UUID's bytes sort lexicographically before the other's
+    /// @note Enables use in ordered containers and the sorted-set kernels in UuidAlgorithms.hpp
+    inline bool operator<(const Uuid& other) const { return _bytes < other._bytes; }
 
     /// @brief Check if this UUID is valid (not the INVALID constant)
     /// @return true if this UUID is not the all-zeros invalid UUID
     /// @note A "valid" UUID here means it's not the INVALID constant, not format validation
     inline bool IsValid() const { return *this != INVALID; }
 
-    /// @brief Convert UUID to its canonical string representation
-    /// @return UUID string in lowercase with hyphens (e.g., "550e8400-e29b-41d4-a716-446655440000")
-    inline std::string ToString() const { return uuids::to_string(_uuid); }
+    /// @brief Get the 16 raw bytes of this UUID
+    /// @return The bytes in canonical (big-endian, string) order
+    constexpr std::array<uint8_t, 16> ToBytes() const { return _bytes; }
 
     /// @brief Get hash value for use in unordered containers
     /// @return Hash value suitable for std::unordered_map, std::unordered_set, etc.
     /// @note This enables using Uuid as a key in hash-based containers
-    inline size_t GetHashCode() const { return std::hash<uuids::uuid>{}(_uuid); }
-
-    /// @brief Stream output operator for easy printing
-    /// @param os The output stream to write to
-    /// @param uuid The UUID to output
-    /// @return Reference to the output stream for chaining
-    /// @note Outputs the UUID in canonical string format
-    friend std::ostream& operator<<(std::ostream& os, const Uuid& uuid)
+    inline size_t GetHashCode() const
     {
-        return os << uuid.ToString();
+        uint64_t halves[2];
+        std::memcpy(halves, _bytes.data(), sizeof(halves));
+        uint64_t hash = (halves[0] * 0x9E3779B97F4A7C15ull) ^ halves[1];
+        hash *= 0xD6E8FEB86659FD93ull;
+        return static_cast<size_t>(hash ^ (hash >> 32));
     }
 
 protected:
@@ -139,15 +160,15 @@ protected:
 private:
     // Private Fields
 
-    /// @brief The underlying UUID implementation
-    uuids::uuid _uuid;
+    /// @brief The 16 bytes in canonical (big-endian, string) order
+    std::array<uint8_t, 16> _bytes;
 
     // Private Methods
 
     /// @brief Private constructor for internal use
-    /// @param uuid The underlying UUID object to wrap
+    /// @param bytes The bytes in canonical order
     /// @note Only accessible to factory methods and internal implementation
-    inline explicit Uuid(const uuids::uuid& uuid) : _uuid(uuid) {}
+    constexpr explicit Uuid(const std::array<uint8_t, 16>& bytes) : _bytes(bytes) {}
 };
 
 } // namespace velecs::common
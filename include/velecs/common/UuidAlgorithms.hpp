@@ -0,0 +1,126 @@
+/// @file    UuidAlgorithms.hpp
+/// @author  Matthew Green
+/// @date    2026-10-18 14:17:40
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/common/Uuid.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace velecs::common {
+
+/// @class UuidAlgorithms
+/// @brief Search, sort and set kernels for contiguous UUID lists.
+///
+/// Treats each Uuid as a 128-bit key. Linear search and counting use AVX2 when the CPU supports
+/// it (selected once at runtime) and 64-bit compares otherwise. Sorting is an LSD radix sort on
+/// the high 64 bits, then on the low 64 bits within runs of equal high halves, skipping byte
+/// positions every key shares; it produces the same order as Uuid::operator<.
+/// The set operations expect inputs sorted by SortUuids() and follow std::set_* semantics.
+///
+/// @code
+/// std::vector<Uuid> selection = ...;
+/// UuidAlgorithms::SortAndDedup(selection);
+/// UuidAlgorithms::SortAndDedup(locked);
+/// std::vector<Uuid> editable = UuidAlgorithms::Difference(selection, locked);
+/// @endcode
+class UuidAlgorithms {
+public:
+    // Enums
+
+    // Public Fields
+
+    // Constructors and Destructors
+
+    /// @brief Default constructor.
+    UuidAlgorithms() = default;
+
+    /// @brief Default deconstructor.
+    ~UuidAlgorithms() = default;
+
+    // Public Methods
+
+    /// @brief Finds the first occurrence of a UUID
+    /// @param data First element of the list
+    /// @param count Number of elements in the list
+    /// @param value The UUID to search for
+    /// @return Index of the first match, or count if the UUID is not present
+    static size_t Find(const Uuid* data, size_t count, const Uuid& value);
+
+    /// @brief Finds the first occurrence of a UUID
+    /// @param uuids The list to search
+    /// @param value The UUID to search for
+    /// @return Index of the first match, or uuids.size() if the UUID is not present
+    static size_t Find(const std::vector<Uuid>& uuids, const Uuid& value) { return Find(uuids.data(), uuids.size(), value); }
+
+    /// @brief Checks whether a list contains a UUID
+    /// @param uuids The list to search
+    /// @param value The UUID to search for
+    /// @return true if the UUID is present
+    static bool Contains(const std::vector<Uuid>& uuids, const Uuid& value) { return Find(uuids, value) != uuids.size(); }
+
+    /// @brief Counts the occurrences of a UUID
+    /// @param data First element of the list
+    /// @param count Number of elements in the list
+    /// @param value The UUID to count
+    /// @return Number of elements equal to value
+    static size_t Count(const Uuid* data, size_t count, const Uuid& value);
+
+    /// @brief Counts the occurrences of a UUID
+    /// @param uuids The list to search
+    /// @param value The UUID to count
+    /// @return Number of elements equal to value
+    static size_t Count(const std::vector<Uuid>& uuids, const Uuid& value) { return Count(uuids.data(), uuids.size(), value); }
+
+    /// @brief Sorts a list into Uuid::operator< order
+    /// @param data First element of the list
+    /// @param count Number of elements in the list
+    /// @note Radix sort for large lists; uses O(count) temporary memory
+    static void Sort(Uuid* data, size_t count);
+
+    /// @brief Sorts a list into Uuid::operator< order
+    /// @param uuids The list to sort in place
+    static void Sort(std::vector<Uuid>& uuids) { Sort(uuids.data(), uuids.size()); }
+
+    /// @brief Sorts a list and removes duplicate UUIDs
+    /// @param uuids The list to sort and deduplicate in place
+    static void SortAndDedup(std::vector<Uuid>& uuids);
+
+    /// @brief Computes the UUIDs present in both sorted lists
+    /// @param a First sorted list
+    /// @param b Second sorted list
+    /// @return Sorted intersection
+    static std::vector<Uuid> Intersection(const std::vector<Uuid>& a, const std::vector<Uuid>& b);
+
+    /// @brief Computes the UUIDs present in either sorted list
+    /// @param a First sorted list
+    /// @param b Second sorted list
+    /// @return Sorted union
+    static std::vector<Uuid> Union(const std::vector<Uuid>& a, const std::vector<Uuid>& b);
+
+    /// @brief Computes the UUIDs present in the first sorted list but not the second
+    /// @param a Sorted list to subtract from
+    /// @param b Sorted list of UUIDs to remove
+    /// @return Sorted difference a - b
+    static std::vector<Uuid> Difference(const std::vector<Uuid>& a, const std::vector<Uuid>& b);
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    // Private Methods
+};
+
+} // namespace velecs::common
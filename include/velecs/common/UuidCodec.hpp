@@ -0,0 +1,101 @@
+/// @file    UuidCodec.hpp
+/// @author  Matthew Green
+/// @date    2026-10-18 14:49:15
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/common/Uuid.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace velecs::common {
+
+/// @class UuidCodec
+/// @brief Compact binary encoding for UUID lists in save files and replication payloads.
+///
+/// Lists are (optionally) sorted, then each UUID is stored as the zigzag varint of its 128-bit
+/// difference from the previous one. Sequential and time-ordered IDs shrink to a byte or two each.
+/// When deltas would not be smaller than the raw 16 bytes per UUID (e.g. random v4 IDs), the list
+/// is stored raw instead. The encoding starts with a mode byte and the varint element count.
+///
+/// @code
+/// std::vector<uint8_t> payload = UuidCodec::Encode(entityIds);
+/// std::vector<Uuid> decoded = UuidCodec::Decode(payload);  // Sorted copy of entityIds
+/// @endcode
+class UuidCodec {
+public:
+    // Enums
+
+    /// @brief How the UUIDs are stored after the header
+    enum class Mode : uint8_t {
+        Raw = 0,    ///< 16 bytes per UUID
+        Delta = 1   ///< Zigzag varint of the difference from the previous UUID
+    };
+
+    // Public Fields
+
+    // Constructors and Destructors
+
+    /// @brief Default constructor.
+    UuidCodec() = default;
+
+    /// @brief Default deconstructor.
+    ~UuidCodec() = default;
+
+    // Public Methods
+
+    /// @brief Encodes a list of UUIDs
+    /// @param data First UUID of the list
+    /// @param count Number of UUIDs
+    /// @param sort Whether to sort before encoding; sorted lists compress best but lose their order
+    /// @return The encoded bytes
+    static std::vector<uint8_t> Encode(const Uuid* data, size_t count, bool sort = true);
+
+    /// @brief Encodes a list of UUIDs
+    /// @param uuids The UUIDs to encode
+    /// @param sort Whether to sort before encoding; sorted lists compress best but lose their order
+    /// @return The encoded bytes
+    static std::vector<uint8_t> Encode(const std::vector<Uuid>& uuids, bool sort = true) { return Encode(uuids.data(), uuids.size(), sort); }
+
+    /// @brief Reads the number of UUIDs in an encoding without decoding them
+    /// @param data Encoded bytes
+    /// @param size Number of encoded bytes
+    /// @return Number of UUIDs Decode() will produce
+    /// @throws std::runtime_error if the header is malformed
+    static size_t DecodedCount(const uint8_t* data, size_t size);
+
+    /// @brief Decodes into existing storage
+    /// @param data Encoded bytes
+    /// @param size Number of encoded bytes
+    /// @param out First UUID to overwrite
+    /// @param capacity Number of UUIDs available at out
+    /// @return Number of UUIDs written
+    /// @throws std::runtime_error if the encoding is malformed or holds more than capacity UUIDs
+    static size_t Decode(const uint8_t* data, size_t size, Uuid* out, size_t capacity);
+
+    /// @brief Decodes into a new list
+    /// @param encoded Encoded bytes
+    /// @return The decoded UUIDs
+    /// @throws std::runtime_error if the encoding is malformed
+    static std::vector<Uuid> Decode(const std::vector<uint8_t>& encoded);
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    // Private Methods
+};
+
+} // namespace velecs::common
@@ -0,0 +1,276 @@
+/// @file    UuidKeyValueStore.hpp
+/// @author  Matthew Green
+/// @date    2026-10-18 16:47:12
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/common/Uuid.hpp"
+
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace velecs::common {
+
+/// @class UuidKeyValueStore
+/// @brief Durable Uuid-keyed blob store backed by a single append-only log file.
+///
+/// Every write appends a checksummed record to the log and updates an in-memory index ordered by
+/// key, so point reads are one positioned read and range scans over time-ordered IDs (v7,
+/// GenerateNodeOrdered) walk keys in creation order. Concurrent writers are group committed: one
+/// thread appends and syncs the records of everyone waiting, then wakes them. Overwritten and
+/// deleted values are reclaimed by compaction, which rewrites the live entries to a new file and
+/// atomically renames it over the log. On open, the log is replayed and truncated at the first
+/// torn or corrupt record, so a crash loses at most the writes that had not returned yet.
+///
+/// @code
+/// UuidKeyValueStore store("PlayerProgress");  // PersistentDataDir()/KeyValue/PlayerProgress.vlkv
+///
+/// store.Put(playerId, saveBytes);
+///
+/// UuidKeyValueStore::WriteBatch batch;
+/// batch.Put(a, thumbnailA);
+/// batch.Delete(b);
+/// store.Write(batch);  // Atomic: all or nothing after a crash
+///
+/// std::vector<uint8_t> value;
+/// if (store.TryGet(playerId, value)) { ... }
+/// @endcode
+class UuidKeyValueStore {
+public:
+    // Enums
+
+    // Public Fields
+
+    /// @brief Tuning options
+    struct Options {
+        /// @brief Sync the log to stable storage before a write returns
+        bool syncOnCommit{true};
+
+        /// @brief Compact in a background thread once garbage passes the thresholds below
+        bool backgroundCompaction{true};
+
+        /// @brief Minimum garbage, in bytes, before compaction is worthwhile
+        uint64_t compactionMinGarbageBytes{4 * 1024 * 1024};
+
+        /// @brief Minimum fraction of the log that must be garbage before compacting
+        double compactionGarbageRatio{0.5};
+    };
+
+    /// @class WriteBatch
+    /// @brief Puts and deletes applied atomically by Write()
+    class WriteBatch {
+    public:
+        /// @brief Stores a value for a key, replacing any previous value
+        void Put(const Uuid& key, const void* data, size_t size);
+
+        /// @brief Stores a value for a key, replacing any previous value
+        void Put(const Uuid& key, const std::vector<uint8_t>& value) { Put(key, value.data(), value.size()); }
+
+        /// @brief Stores a value for a key, replacing any previous value
+        void Put(const Uuid& key, const std::string& value) { Put(key, value.data(), value.size()); }
+
+        /// @brief Removes a key
+        void Delete(const Uuid& key);
+
+        /// @brief Gets the number of operations in the batch
+        size_t Size() const { return _count; }
+
+        /// @brief Checks whether the batch has no operations
+        bool Empty() const { return _count == 0; }
+
+        /// @brief Removes every operation from the batch
+        void Clear() { _entries.clear(); _count = 0; }
+
+    private:
+        friend class UuidKeyValueStore;
+
+        std::vector<uint8_t> _entries;
+        uint32_t _count{0};
+    };
+
+    /// @brief Receives each entry of a scan; return false to stop early
+    using ScanCallback = std::function<bool(const Uuid&, const std::vector<uint8_t>&)>;
+
+    // Constructors and Destructors
+
+    /// @brief Opens or creates a store in Paths::PersistentDataDir()/KeyValue with default options
+    /// @param name Store name, used as the file name
+    /// @throws std::runtime_error if Paths is not initialized or the log cannot be opened
+    explicit UuidKeyValueStore(const std::string& name);
+
+    /// @brief Opens or creates a store in Paths::PersistentDataDir()/KeyValue
+    /// @param name Store name, used as the file name
+    /// @param options Tuning options
+    /// @throws std::runtime_error if Paths is not initialized or the log cannot be opened
+    UuidKeyValueStore(const std::string& name, const Options& options);
+
+    /// @brief Opens or creates a store at an explicit path
+    /// @param file Path of the log file
+    /// @param options Tuning options
+    /// @throws std::runtime_error if the log cannot be opened or has a foreign header
+    UuidKeyValueStore(const std::filesystem::path& file, const Options& options);
+
+    /// @brief Destructor. Stops background compaction and closes the log.
+    ~UuidKeyValueStore();
+
+    UuidKeyValueStore(const UuidKeyValueStore&) = delete;
+    UuidKeyValueStore& operator=(const UuidKeyValueStore&) = delete;
+
+    // Public Methods
+
+    /// @brief Stores a value for a key, replacing any previous value
+    /// @throws std::runtime_error if the log cannot be written
+    void Put(const Uuid& key, const void* data, size_t size);
+
+    /// @brief Stores a value for a key, replacing any previous value
+    /// @throws std::runtime_error if the log cannot be written
+    void Put(const Uuid& key, const std::vector<uint8_t>& value) { Put(key, value.data(), value.size()); }
+
+    /// @brief Stores a value for a key, replacing any previous value
+    /// @throws std::runtime_error if the log cannot be written
+    void Put(const Uuid& key, const std::string& value) { Put(key, value.data(), value.size()); }
+
+    /// @brief Removes a key
+    /// @throws std::runtime_error if the log cannot be written
+    void Delete(const Uuid& key);
+
+    /// @brief Applies a batch atomically, group committed with concurrent writers
+    /// @param batch The operations to apply
+    /// @throws std::runtime_error if the log cannot be written; none of the batch is applied
+    void Write(const WriteBatch& batch);
+
+    /// @brief Reads the value stored for a key
+    /// @param key The key to look up
+    /// @param outValue Receives the value if found
+    /// @return true if the key was found
+    bool TryGet(const Uuid& key, std::vector<uint8_t>& outValue) const;
+
+    /// @brief Reads the value stored for a key
+    /// @param key The key to look up
+    /// @return The value, or std::nullopt if the key is absent
+    std::optional<std::vector<uint8_t>> Get(const Uuid& key) const;
+
+    /// @brief Checks whether a key is present
+    bool Contains(const Uuid& key) const;
+
+    /// @brief Visits entries with first <= key < last in key order
+    /// @note Entries are copied out in batches and the callback runs without locks held, so it may
+    /// write to the store. Writes made during the scan may or may not be visited.
+    /// @param first Inclusive lower bound
+    /// @param last Exclusive upper bound
+    /// @param callback Called for each entry; return false to stop
+    void ScanRange(const Uuid& first, const Uuid& last, const ScanCallback& callback) const;
+
+    /// @brief Visits every entry in key order
+    /// @note Same batching and callback rules as ScanRange()
+    /// @param callback Called for each entry; return false to stop
+    void ForEach(const ScanCallback& callback) const;
+
+    /// @brief Rewrites the log with only live entries
+    /// @note Writers are blocked only while records appended during the rewrite are carried over and
+    /// the new log is swapped in
+    /// @throws std::runtime_error if the compacted log cannot be written; the original is kept
+    void Compact();
+
+    /// @brief Gets the number of keys
+    size_t Size() const;
+
+    /// @brief Gets the size of the log file in bytes
+    uint64_t FileBytes() const;
+
+    /// @brief Gets the bytes of the log held by overwritten or deleted entries
+    uint64_t GarbageBytes() const;
+
+    /// @brief Gets the path of the log file
+    const std::filesystem::path& GetPath() const { return _path; }
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    /// @brief Where a value lives in the log
+    struct Location {
+        uint64_t offset;
+        uint32_t size;
+    };
+
+    /// @brief A writer waiting for its record to be group committed
+    struct CommitRequest {
+        const std::vector<uint8_t>* record;
+        bool done{false};
+        std::exception_ptr error;
+    };
+
+    // Private Fields
+
+    std::filesystem::path _path;
+    Options _options;
+    int _fd{-1};
+
+    /// @brief Guards the index, the file descriptor and the size counters
+    mutable std::shared_mutex _indexMutex;
+    std::map<Uuid, Location> _index;
+    uint64_t _fileSize{0};
+    uint64_t _garbageBytes{0};
+
+    /// @brief Serializes appends with each other and with the final stage of compaction. _fileSize only
+    /// changes with both this and the index lock held, so either is enough to read it.
+    std::mutex _appendMutex;
+
+    /// @brief Serializes compactions; only compaction replaces _fd
+    std::mutex _compactMutex;
+
+    std::mutex _commitMutex;
+    std::condition_variable _commitCv;
+    std::vector<CommitRequest*> _commitQueue;
+    bool _leaderActive{false};
+
+    std::mutex _compactionMutex;
+    std::condition_variable _compactionCv;
+    bool _stopCompaction{false};
+    bool _compactionRequested{false};
+    std::thread _compactionThread;
+
+    // Private Methods
+
+    /// @brief Replays the log into the index, truncating any torn tail
+    void Recover();
+
+    /// @brief Appends a group of records in one write and applies them to the index
+    void AppendGroup(const std::vector<CommitRequest*>& group);
+
+    /// @brief Adds a record's entries to the index (index lock held)
+    void ApplyRecord(const uint8_t* payload, size_t size, uint64_t payloadOffset);
+
+    /// @brief Copies entries out in batches and invokes the callback without locks held
+    void Scan(const Uuid* first, const Uuid* last, const ScanCallback& callback) const;
+
+    /// @brief Reads a value from the log (index or compaction lock held)
+    void ReadValue(const Location& location, std::vector<uint8_t>& outValue) const;
+
+    /// @brief Checks the compaction thresholds (index lock held)
+    bool ShouldCompact() const;
+
+    /// @brief Body of the background compaction thread
+    void CompactionLoop();
+};
+
+} // namespace velecs::common
@@ -0,0 +1,84 @@
+/// @file    UuidNamespace.hpp
+/// @author  Matthew Green
+/// @date    2026-10-18 13:52:08
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/common/Uuid.hpp"
+
+#include <string>
+#include <string_view>
+
+namespace velecs::common {
+
+/// @class UuidNamespace
+/// @brief A parent UUID prepared for deriving many name-based (v5) child UUIDs.
+///
+/// Hashes the parent's bytes and each child's name directly, without building a name generator
+/// per call. Produces exactly the same UUIDs as UuidString::GenerateFromName(parent, name), which lets
+/// hierarchies be derived one level at a time (scene -> node -> component) rather than by hashing
+/// a concatenated path for every object.
+///
+/// @code
+/// UuidNamespace scene(sceneUuid);
+/// for (const auto& node : nodes)
+/// {
+///     UuidNamespace nodeNamespace = scene.Nest(node.name);
+///     for (const auto& component : node.components)
+///     {
+///         Uuid componentUuid = nodeNamespace.Derive(component.name);
+///     }
+/// }
+/// @endcode
+class UuidNamespace {
+public:
+    // Enums
+
+    // Public Fields
+
+    // Constructors and Destructors
+
+    /// @brief Prepares a parent UUID for child derivation
+    /// @param parent The UUID whose children will be derived
+    explicit UuidNamespace(const Uuid& parent);
+
+    /// @brief Default destructor
+    ~UuidNamespace() = default;
+
+    // Public Methods
+
+    /// @brief Derives the UUID of a child of this namespace
+    /// @param name The child's name, unique among its siblings
+    /// @return Same value as UuidString::GenerateFromName(GetParent(), name)
+    Uuid Derive(std::string_view name) const;
+
+    /// @brief Derives a child and prepares it as a namespace for its own children
+    /// @param name The child's name, unique among its siblings
+    /// @return Namespace for Derive(name)
+    UuidNamespace Nest(std::string_view name) const { return UuidNamespace(Derive(name)); }
+
+    /// @brief Gets the parent UUID this namespace derives from
+    /// @return The parent UUID
+    const Uuid& GetParent() const { return _parent; }
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    /// @brief The parent UUID
+    Uuid _parent;
+
+    // Private Methods
+};
+
+} // namespace velecs::common
@@ -0,0 +1,31 @@
+/// @file    UuidStream.hpp
+/// @author  Matthew Green
+/// @date    2026-10-18 19:41:20
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/common/Uuid.hpp"
+#include "velecs/common/UuidString.hpp"
+
+#include <ostream>
+
+namespace velecs::common {
+
+/// @brief Stream output operator for easy printing
+/// @param os The output stream to write to
+/// @param uuid The UUID to output
+/// @return Reference to the output stream for chaining
+/// @note Outputs the UUID in canonical string format. Kept out of Uuid.hpp so only
+///       translation units that stream IDs pay for <ostream>.
+inline std::ostream& operator<<(std::ostream& os, const Uuid& uuid)
+{
+    return os << UuidString::ToString(uuid);
+}
+
+} // namespace velecs::common
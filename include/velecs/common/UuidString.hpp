@@ -0,0 +1,87 @@
+/// @file    UuidString.hpp
+/// @author  Matthew Green
+/// @date    2026-10-18 23:41:09
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#pragma once
+
+#include "velecs/common/Uuid.hpp"
+
+#include <optional>
+#include <string>
+
+namespace velecs::common {
+
+/// @class UuidString
+/// @brief Text conversion and name-based generation for Uuid.
+///
+/// Kept apart from Uuid.hpp so code that only stores, compares and hashes IDs does not pay for
+/// <string> and <optional>.
+///
+/// @code
+/// Uuid world = UuidString::GenerateFromString("MyGameWorld123");
+/// std::string text = UuidString::ToString(world);
+/// std::optional<Uuid> parsed = UuidString::FromString(text);
+/// @endcode
+class UuidString {
+public:
+    // Enums
+
+    // Public Fields
+
+    // Constructors and Destructors
+
+    /// @brief Deleted constructor - UuidString only exposes static methods
+    UuidString() = delete;
+
+    // Public Methods
+
+    /// @brief Generate a deterministic UUID from a string seed (name-based UUID v5)
+    /// @param seed The string seed (any length, e.g., "MyGameWorld123")
+    /// @return A UUID that's always the same for the same seed string
+    /// @note Uses SHA-1 hashing with velecs namespace. Same input always produces same output
+    static Uuid GenerateFromString(const std::string& seed);
+
+    /// @brief Generate a deterministic child UUID from a parent UUID and a name (name-based UUID v5)
+    /// @param parent The parent UUID, used as the v5 namespace
+    /// @param name The child's name, unique among its siblings (e.g., "Transform")
+    /// @return A UUID that's always the same for the same parent and name
+    /// @note Chaining this per level (scene -> node -> component) hashes only each child's name instead of
+    ///       the full path. Use UuidNamespace when deriving many children of the same parent.
+    static Uuid GenerateFromName(const Uuid& parent, const std::string& name);
+
+    /// @brief Generate a deterministic UUID by hashing string to numeric seed
+    /// @param seed The string seed to hash into a numeric value
+    /// @return A UUID generated from the hashed numeric seed
+    /// @note Hashes string to size_t, then truncates to uint32_t for Uuid::GenerateFromSeed()
+    /// @warning Different from GenerateFromString() - may have hash collisions
+    static Uuid GenerateFromStringHash(const std::string& seed);
+
+    /// @brief Parse a UUID from a string representation
+    /// @param uuid The UUID string in canonical format (e.g., "550e8400-e29b-41d4-a716-446655440000")
+    /// @return The parsed UUID, or std::nullopt if parsing failed
+    /// @note Accepts both uppercase and lowercase hex digits, with or without hyphens
+    static std::optional<Uuid> FromString(const std::string& uuid);
+
+    /// @brief Convert a UUID to its canonical string representation
+    /// @param uuid The UUID to format
+    /// @return UUID string in lowercase with hyphens (e.g., "550e8400-e29b-41d4-a716-446655440000")
+    static std::string ToString(const Uuid& uuid);
+
+protected:
+    // Protected Fields
+
+    // Protected Methods
+
+private:
+    // Private Fields
+
+    // Private Methods
+};
+
+} // namespace velecs::common
@@ -0,0 +1,189 @@
+/// @file    ConcurrentUuidMap.cpp
+/// @author  Matthew Green
+/// @date    2026-10-18 15:26:33
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/common/ConcurrentUuidMap.hpp"
+
+#include <algorithm>
+#include <vector>
+
+namespace velecs::common {
+
+namespace {
+
+/// @brief Reader state of one thread, linked into a global list and reused after the thread exits
+struct ThreadRecord {
+    /// @brief Global epoch observed on entering a guard, or 0 while outside any guard
+    std::atomic<uint64_t> epoch{0};
+    std::atomic<bool> inUse{false};
+    ThreadRecord* next{nullptr};
+};
+
+struct RetiredObject {
+    void* pointer;
+    EpochReclaimer::Deleter deleter;
+    uint64_t epoch;
+};
+
+constexpr size_t COLLECT_THRESHOLD = 64;
+
+std::atomic<uint64_t> g_epoch{1};
+std::atomic<ThreadRecord*> g_records{nullptr};
+
+/// @brief Objects retired by threads that exited before they could be freed
+struct OrphanList {
+    std::mutex mutex;
+    std::vector<RetiredObject> objects;
+
+    /// @brief Frees everything left at process teardown, when no guard can still be active
+    ~OrphanList()
+    {
+        for (const RetiredObject& object : objects)
+        {
+            object.deleter(object.pointer);
+        }
+    }
+};
+
+OrphanList g_orphans;
+
+ThreadRecord* AcquireRecord()
+{
+    for (ThreadRecord* record = g_records.load(std::memory_order_acquire); record != nullptr; record = record->next)
+    {
+        bool expected = false;
+        if (!record->inUse.load(std::memory_order_relaxed)
+            && record->inUse.compare_exchange_strong(expected, true, std::memory_order_acq_rel))
+        {
+            return record;
+        }
+    }
+
+    // Records are never freed, so readers of the list never see a dangling pointer
+    ThreadRecord* record = new ThreadRecord();
+    record->inUse.store(true, std::memory_order_relaxed);
+    record->next = g_records.load(std::memory_order_relaxed);
+    while (!g_records.compare_exchange_weak(record->next, record, std::memory_order_release, std::memory_order_relaxed))
+    {
+    }
+    return record;
+}
+
+/// @brief Advances the global epoch if every thread inside a guard has observed the current one
+void TryAdvanceEpoch()
+{
+    uint64_t current = g_epoch.load(std::memory_order_seq_cst);
+    for (ThreadRecord* record = g_records.load(std::memory_order_acquire); record != nullptr; record = record->next)
+    {
+        const uint64_t observed = record->epoch.load(std::memory_order_seq_cst);
+        if (observed != 0 && observed != current) return;
+    }
+    g_epoch.compare_exchange_strong(current, current + 1, std::memory_order_seq_cst);
+}
+
+/// @brief Frees objects retired at least two epochs ago; no guard can still reach them
+void FreeReclaimable(std::vector<RetiredObject>& retired)
+{
+    const uint64_t current = g_epoch.load(std::memory_order_acquire);
+    auto reclaimable = std::partition(retired.begin(), retired.end(),
+        [current](const RetiredObject& object) { return object.epoch + 2 > current; });
+
+    for (auto it = reclaimable; it != retired.end(); ++it)
+    {
+        it->deleter(it->pointer);
+    }
+    retired.erase(reclaimable, retired.end());
+}
+
+struct ThreadState {
+    ThreadRecord* record{AcquireRecord()};
+    unsigned nesting{0};
+    std::vector<RetiredObject> retired;
+
+    ~ThreadState()
+    {
+        record->epoch.store(0, std::memory_order_release);
+        record->inUse.store(false, std::memory_order_release);
+
+        TryAdvanceEpoch();
+        TryAdvanceEpoch();
+        FreeReclaimable(retired);
+
+        if (retired.empty()) return;
+        std::lock_guard<std::mutex> lock(g_orphans.mutex);
+        g_orphans.objects.insert(g_orphans.objects.end(), retired.begin(), retired.end());
+    }
+};
+
+ThreadState& LocalState()
+{
+    thread_local ThreadState state;
+    return state;
+}
+
+} // namespace
+
+// Public Fields
+
+// Constructors and Destructors
+
+// Public Methods
+
+void EpochReclaimer::Enter()
+{
+    ThreadState& state = LocalState();
+    if (state.nesting++ != 0) return;
+
+    // Publish the observed epoch, retrying if it moved on before the publication became visible
+    uint64_t epoch = g_epoch.load(std::memory_order_seq_cst);
+    while (true)
+    {
+        state.record->epoch.store(epoch, std::memory_order_seq_cst);
+        const uint64_t latest = g_epoch.load(std::memory_order_seq_cst);
+        if (latest == epoch) break;
+        epoch = latest;
+    }
+}
+
+void EpochReclaimer::Exit()
+{
+    ThreadState& state = LocalState();
+    if (--state.nesting != 0) return;
+
+    state.record->epoch.store(0, std::memory_order_release);
+}
+
+void EpochReclaimer::Retire(void* pointer, Deleter deleter)
+{
+    ThreadState& state = LocalState();
+    state.retired.push_back({pointer, deleter, g_epoch.load(std::memory_order_seq_cst)});
+
+    if (state.retired.size() >= COLLECT_THRESHOLD) Collect();
+}
+
+void EpochReclaimer::Collect()
+{
+    TryAdvanceEpoch();
+
+    ThreadState& state = LocalState();
+    FreeReclaimable(state.retired);
+
+    std::unique_lock<std::mutex> lock(g_orphans.mutex, std::try_to_lock);
+    if (lock.owns_lock() && !g_orphans.objects.empty()) FreeReclaimable(g_orphans.objects);
+}
+
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+// Private Methods
+
+} // namespace velecs::common
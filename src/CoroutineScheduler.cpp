@@ -0,0 +1,129 @@
+/// @file    CoroutineScheduler.cpp
+/// @author  Matthew Green
+/// @date    2026-10-18 21:15:03
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/common/CoroutineScheduler.hpp"
+
+#if VELECS_HAS_COROUTINES
+
+#include "velecs/common/Paths.hpp"
+#include "velecs/common/StartupReadahead.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+
+namespace velecs::common {
+
+namespace {
+
+/// @brief Scheduler whose worker is running on this thread, if any
+thread_local const CoroutineScheduler* t_currentScheduler = nullptr;
+
+} // namespace
+
+// Public Fields
+
+// Constructors and Destructors
+
+CoroutineScheduler::CoroutineScheduler(size_t threadCount)
+{
+    if (threadCount == 0) threadCount = std::max(1u, std::thread::hardware_concurrency());
+
+    _workers.reserve(threadCount);
+    for (size_t i = 0; i < threadCount; ++i)
+    {
+        _workers.emplace_back([this] { WorkerLoop(); });
+    }
+}
+
+CoroutineScheduler::~CoroutineScheduler()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stopping = true;
+    }
+    _cv.notify_all();
+
+    for (std::thread& worker : _workers)
+    {
+        worker.join();
+    }
+}
+
+// Public Methods
+
+void CoroutineScheduler::Post(std::coroutine_handle<> handle)
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _queue.push_back(handle);
+    }
+    _cv.notify_one();
+}
+
+bool CoroutineScheduler::IsWorkerThread() const
+{
+    return t_currentScheduler == this;
+}
+
+Task<std::vector<uint8_t>> ReadFileAsync(CoroutineScheduler& scheduler, std::filesystem::path path)
+{
+    co_await scheduler.Schedule();
+
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) throw std::runtime_error("Failed to open '" + path.string() + "'.");
+
+    const std::streamsize size = file.tellg();
+    std::vector<uint8_t> bytes(static_cast<size_t>(size > 0 ? size : 0));
+    file.seekg(0);
+    if (size > 0 && !file.read(reinterpret_cast<char*>(bytes.data()), size))
+        throw std::runtime_error("Failed to read '" + path.string() + "'.");
+
+    StartupReadahead::NoteAccess(path, 0, bytes.size());
+    co_return bytes;
+}
+
+Task<std::vector<uint8_t>> ReadAssetAsync(CoroutineScheduler& scheduler, std::filesystem::path relativePath)
+{
+    // Resolve before hopping threads so an uninitialized Paths throws to the caller's frame
+    std::filesystem::path path = Paths::AssetsDir() / relativePath;
+    co_return co_await ReadFileAsync(scheduler, std::move(path));
+}
+
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+// Private Methods
+
+void CoroutineScheduler::WorkerLoop()
+{
+    t_currentScheduler = this;
+
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (true)
+    {
+        _cv.wait(lock, [this] { return _stopping || !_queue.empty(); });
+        if (_queue.empty()) return; // Stopping and drained
+
+        std::coroutine_handle<> handle = _queue.front();
+        _queue.pop_front();
+
+        lock.unlock();
+        handle.resume();
+        lock.lock();
+    }
+}
+
+} // namespace velecs::common
+
+#endif // VELECS_HAS_COROUTINES
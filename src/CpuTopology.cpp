@@ -0,0 +1,422 @@
+/// @file    CpuTopology.cpp
+/// @author  Matthew Green
+/// @date    2026-10-18 20:41:57
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/common/CpuTopology.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <map>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+#include <utility>
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#elif defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace velecs::common {
+
+namespace {
+
+#ifdef __linux__
+// From <linux/mempolicy.h>; spelled out so libnuma headers are not required
+constexpr int MPOL_PREFERRED_MODE = 1;
+constexpr int MPOL_BIND_MODE = 2;
+
+/// @brief Node mask wide enough for any node id the kernel hands out in practice
+constexpr size_t NODE_MASK_WORDS = 16;
+constexpr size_t NODE_MASK_BITS = NODE_MASK_WORDS * sizeof(unsigned long) * 8;
+#endif
+
+/// @brief Largest CPU id accepted from a CPU list. Far above the kernel's NR_CPUS limit; bounds
+/// what a corrupt list or test sysRoot can make ParseCpuList() allocate.
+constexpr uint32_t MAX_CPU_ID = 65535;
+
+bool ReadLine(const std::filesystem::path& path, std::string& out)
+{
+    std::ifstream file(path);
+    if (!file || !std::getline(file, out)) return false;
+    while (!out.empty() && (out.back() == '\n' || out.back() == '\r' || out.back() == ' ')) out.pop_back();
+    return true;
+}
+
+/// @brief Reads an integer file, returning fallback if it is missing or negative (e.g. package id -1)
+uint32_t ReadId(const std::filesystem::path& path, uint32_t fallback)
+{
+    std::string text;
+    if (!ReadLine(path, text)) return fallback;
+    try
+    {
+        long value = std::stol(text);
+        return value < 0 ? fallback : static_cast<uint32_t>(value);
+    }
+    catch (const std::exception&)
+    {
+        return fallback;
+    }
+}
+
+/// @brief Parses a whole string of decimal digits into a uint32_t without throwing
+bool ParseId(const std::string& text, uint32_t& out)
+{
+    if (text.empty() || !std::all_of(text.begin(), text.end(), [](unsigned char c) { return std::isdigit(c) != 0; })) return false;
+    try
+    {
+        const unsigned long long value = std::stoull(text);
+        if (value > UINT32_MAX) return false;
+        out = static_cast<uint32_t>(value);
+        return true;
+    }
+    catch (const std::exception&)
+    {
+        return false;
+    }
+}
+
+/// @brief Hands out dense indices in first-seen order
+template<typename Key>
+uint32_t DenseIndex(std::map<Key, uint32_t>& indices, const Key& key)
+{
+    return indices.emplace(key, static_cast<uint32_t>(indices.size())).first->second;
+}
+
+} // namespace
+
+// Public Fields
+
+// Constructors and Destructors
+
+// Public Methods
+
+const CpuTopology& CpuTopology::Get()
+{
+    static const CpuTopology topology = Detect();
+    return topology;
+}
+
+CpuTopology CpuTopology::Detect(const std::filesystem::path& sysRoot)
+{
+    std::string onlineList;
+    if (!ReadLine(sysRoot / "cpu" / "online", onlineList)) return Fallback();
+
+    std::vector<uint32_t> online = ParseCpuList(onlineList);
+    if (online.empty()) return Fallback();
+
+    // CPU -> NUMA node; kernels without NUMA support have no node directory
+    std::map<uint32_t, uint32_t> nodeOf;
+    std::error_code error;
+    for (const auto& entry : std::filesystem::directory_iterator(sysRoot / "node", error))
+    {
+        const std::string name = entry.path().filename().string();
+        uint32_t node;
+        if (name.rfind("node", 0) != 0 || !ParseId(name.substr(4), node)) continue;
+
+        std::string cpuList;
+        if (!ReadLine(entry.path() / "cpulist", cpuList)) continue;
+
+        for (uint32_t cpu : ParseCpuList(cpuList)) nodeOf[cpu] = node;
+    }
+
+    CpuTopology topology;
+    std::map<uint32_t, uint32_t> packages;
+    std::map<std::pair<uint32_t, uint32_t>, uint32_t> cores;
+    std::map<std::string, uint32_t> l2Groups;
+    std::map<std::string, uint32_t> l3Groups;
+    std::map<uint32_t, bool> nodes;
+
+    for (uint32_t id : online)
+    {
+        const std::filesystem::path cpuDir = sysRoot / "cpu" / ("cpu" + std::to_string(id));
+
+        LogicalCpu cpu;
+        cpu.id = id;
+
+        const uint32_t packageId = ReadId(cpuDir / "topology" / "physical_package_id", 0);
+        const uint32_t coreId = ReadId(cpuDir / "topology" / "core_id", id);
+        cpu.package = DenseIndex(packages, packageId);
+        cpu.core = DenseIndex(cores, std::make_pair(packageId, coreId));
+
+        auto node = nodeOf.find(id);
+        cpu.numaNode = node != nodeOf.end() ? node->second : 0;
+        nodes[cpu.numaNode] = true;
+
+        for (const auto& entry : std::filesystem::directory_iterator(cpuDir / "cache", error))
+        {
+            std::string level, type, shared;
+            if (!ReadLine(entry.path() / "level", level) || !ReadLine(entry.path() / "shared_cpu_list", shared)) continue;
+            if (ReadLine(entry.path() / "type", type) && type == "Instruction") continue;
+
+            // Caches are identified by the exact set of CPUs sharing them
+            if (level == "2") cpu.l2Group = DenseIndex(l2Groups, shared);
+            else if (level == "3") cpu.l3Group = DenseIndex(l3Groups, shared);
+        }
+
+        topology._cpus.push_back(cpu);
+    }
+
+    for (const auto& node : nodes) topology._numaNodes.push_back(node.first);
+    topology._coreCount = cores.size();
+    topology._packageCount = packages.size();
+    return topology;
+}
+
+const CpuTopology::LogicalCpu& CpuTopology::Cpu(uint32_t id) const
+{
+    auto it = std::lower_bound(_cpus.begin(), _cpus.end(), id,
+        [](const LogicalCpu& cpu, uint32_t value) { return cpu.id < value; });
+    if (it == _cpus.end() || it->id != id)
+        throw std::out_of_range("CpuTopology::Cpu() CPU " + std::to_string(id) + " is not online");
+    return *it;
+}
+
+std::vector<uint32_t> CpuTopology::CpusOfCore(uint32_t core) const
+{
+    return Select([core](const LogicalCpu& cpu) { return cpu.core == core; });
+}
+
+std::vector<uint32_t> CpuTopology::CpusInPackage(uint32_t package) const
+{
+    return Select([package](const LogicalCpu& cpu) { return cpu.package == package; });
+}
+
+std::vector<uint32_t> CpuTopology::CpusInNumaNode(uint32_t node) const
+{
+    return Select([node](const LogicalCpu& cpu) { return cpu.numaNode == node; });
+}
+
+std::vector<uint32_t> CpuTopology::CpusSharingL2(uint32_t cpu) const
+{
+    const uint32_t group = Cpu(cpu).l2Group;
+    if (group == NO_GROUP) return {cpu};
+    return Select([group](const LogicalCpu& other) { return other.l2Group == group; });
+}
+
+std::vector<uint32_t> CpuTopology::CpusSharingL3(uint32_t cpu) const
+{
+    const uint32_t group = Cpu(cpu).l3Group;
+    if (group == NO_GROUP) return {cpu};
+    return Select([group](const LogicalCpu& other) { return other.l3Group == group; });
+}
+
+std::vector<uint32_t> CpuTopology::PreferredOrder() const
+{
+    // Rank of each CPU within its core: 0 for the first hardware thread, 1 for its sibling, ...
+    std::vector<std::tuple<uint32_t, uint32_t, uint32_t, uint32_t, uint32_t>> keys;
+    std::map<uint32_t, uint32_t> seenPerCore;
+    for (const LogicalCpu& cpu : _cpus)
+    {
+        const uint32_t smtRank = seenPerCore[cpu.core]++;
+        keys.emplace_back(smtRank, cpu.numaNode, cpu.l3Group, cpu.core, cpu.id);
+    }
+    std::sort(keys.begin(), keys.end());
+
+    std::vector<uint32_t> order;
+    order.reserve(keys.size());
+    for (const auto& key : keys) order.push_back(std::get<4>(key));
+    return order;
+}
+
+bool CpuTopology::PinCurrentThread(uint32_t cpu)
+{
+    return PinCurrentThread(std::vector<uint32_t>{cpu});
+}
+
+bool CpuTopology::PinCurrentThread(const std::vector<uint32_t>& cpus)
+{
+    if (cpus.empty()) return false;
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (uint32_t cpu : cpus)
+    {
+        if (cpu >= CPU_SETSIZE) return false;
+        CPU_SET(cpu, &set);
+    }
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#elif defined(_WIN32)
+    // Only processor group 0 is addressable through a plain affinity mask
+    DWORD_PTR mask = 0;
+    for (uint32_t cpu : cpus)
+    {
+        if (cpu >= sizeof(DWORD_PTR) * 8) return false;
+        mask |= DWORD_PTR{1} << cpu;
+    }
+    return SetThreadAffinityMask(GetCurrentThread(), mask) != 0;
+#else
+    return false;
+#endif
+}
+
+std::vector<uint32_t> CpuTopology::CurrentAffinity()
+{
+    std::vector<uint32_t> cpus;
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (pthread_getaffinity_np(pthread_self(), sizeof(set), &set) != 0) return cpus;
+    for (uint32_t cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+    {
+        if (CPU_ISSET(cpu, &set)) cpus.push_back(cpu);
+    }
+#elif defined(_WIN32)
+    // Windows cannot query a thread's mask directly; report the process mask it is bounded by
+    DWORD_PTR processMask = 0;
+    DWORD_PTR systemMask = 0;
+    if (!GetProcessAffinityMask(GetCurrentProcess(), &processMask, &systemMask)) return cpus;
+    for (uint32_t cpu = 0; cpu < sizeof(DWORD_PTR) * 8; ++cpu)
+    {
+        if ((processMask >> cpu) & 1) cpus.push_back(cpu);
+    }
+#endif
+    return cpus;
+}
+
+uint32_t CpuTopology::CurrentCpu()
+{
+#if defined(__linux__)
+    const int cpu = sched_getcpu();
+    return cpu < 0 ? UINT32_MAX : static_cast<uint32_t>(cpu);
+#elif defined(_WIN32)
+    return static_cast<uint32_t>(GetCurrentProcessorNumber());
+#else
+    return UINT32_MAX;
+#endif
+}
+
+void* CpuTopology::AllocateOnNode(size_t size, uint32_t node)
+{
+    if (size == 0) return nullptr;
+#if defined(__linux__)
+    void* memory = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (memory == MAP_FAILED) return nullptr;
+
+    // Pages are placed on first touch, so binding before use is enough; without NUMA support this fails harmlessly
+    BindMemoryToNode(memory, size, node);
+    return memory;
+#elif defined(_WIN32)
+    return VirtualAllocExNuma(GetCurrentProcess(), nullptr, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE, node);
+#else
+    (void)node;
+    return ::operator new(size, std::align_val_t{4096}, std::nothrow);
+#endif
+}
+
+void CpuTopology::FreeOnNode(void* memory, size_t size)
+{
+    if (memory == nullptr) return;
+#if defined(__linux__)
+    ::munmap(memory, size);
+#elif defined(_WIN32)
+    (void)size;
+    VirtualFree(memory, 0, MEM_RELEASE);
+#else
+    (void)size;
+    ::operator delete(memory, std::align_val_t{4096});
+#endif
+}
+
+bool CpuTopology::BindMemoryToNode(void* memory, size_t size, uint32_t node)
+{
+#if defined(__linux__) && defined(SYS_mbind)
+    if (node >= NODE_MASK_BITS) return false;
+    unsigned long mask[NODE_MASK_WORDS] = {};
+    mask[node / (sizeof(unsigned long) * 8)] = 1ul << (node % (sizeof(unsigned long) * 8));
+    return ::syscall(SYS_mbind, memory, size, MPOL_BIND_MODE, mask, NODE_MASK_BITS, 0) == 0;
+#else
+    (void)memory;
+    (void)size;
+    (void)node;
+    return false;
+#endif
+}
+
+bool CpuTopology::PreferNodeForCurrentThread(uint32_t node)
+{
+#if defined(__linux__) && defined(SYS_set_mempolicy)
+    if (node >= NODE_MASK_BITS) return false;
+    unsigned long mask[NODE_MASK_WORDS] = {};
+    mask[node / (sizeof(unsigned long) * 8)] = 1ul << (node % (sizeof(unsigned long) * 8));
+    return ::syscall(SYS_set_mempolicy, MPOL_PREFERRED_MODE, mask, NODE_MASK_BITS) == 0;
+#else
+    (void)node;
+    return false;
+#endif
+}
+
+std::vector<uint32_t> CpuTopology::ParseCpuList(const std::string& list)
+{
+    // Marking ids instead of appending them keeps overlapping or repeated ranges from growing the result
+    std::vector<bool> present;
+    size_t position = 0;
+    while (position < list.size())
+    {
+        size_t end = list.find(',', position);
+        if (end == std::string::npos) end = list.size();
+        const std::string range = list.substr(position, end - position);
+        position = end + 1;
+        if (range.empty()) continue;
+
+        // Malformed, reversed or out-of-bounds entries are skipped rather than discarding the whole list
+        const size_t dash = range.find('-');
+        uint32_t first;
+        uint32_t last;
+        if (!ParseId(range.substr(0, dash), first)) continue;
+        if (dash == std::string::npos) last = first;
+        else if (!ParseId(range.substr(dash + 1), last)) continue;
+        if (first > last || last > MAX_CPU_ID) continue;
+
+        if (present.size() <= last) present.resize(size_t{last} + 1);
+        for (uint32_t cpu = first; cpu <= last; ++cpu) present[cpu] = true;
+    }
+
+    std::vector<uint32_t> cpus;
+    for (size_t cpu = 0; cpu < present.size(); ++cpu)
+    {
+        if (present[cpu]) cpus.push_back(static_cast<uint32_t>(cpu));
+    }
+    return cpus;
+}
+
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+// Private Methods
+
+CpuTopology CpuTopology::Fallback()
+{
+    CpuTopology topology;
+    const uint32_t count = std::max(1u, std::thread::hardware_concurrency());
+    for (uint32_t id = 0; id < count; ++id)
+    {
+        LogicalCpu cpu;
+        cpu.id = id;
+        cpu.core = id;
+        topology._cpus.push_back(cpu);
+    }
+    topology._numaNodes.push_back(0);
+    topology._coreCount = count;
+    topology._packageCount = 1;
+    return topology;
+}
+
+} // namespace velecs::common
@@ -0,0 +1,147 @@
+/// @file    EntropyPool.cpp
+/// @author  Matthew Green
+/// @date    2026-10-18 16:08:51
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/common/EntropyPool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#ifdef __linux__
+#include <cerrno>
+#include <sys/random.h>
+#endif
+
+#ifndef _WIN32
+#include <pthread.h>
+#endif
+
+namespace velecs::common {
+
+namespace {
+
+std::mutex g_mutex;
+
+/// @brief Unconsumed entropy lives in [g_cursor, g_buffer.size())
+std::vector<uint8_t> g_buffer;
+size_t g_cursor = 0;
+
+/// @brief Bumped whenever buffered entropy is discarded because the process forked
+std::atomic<uint64_t> g_generation{0};
+
+/// @brief Reads exactly size bytes of operating-system entropy
+void ReadSystemEntropy(uint8_t* out, size_t size)
+{
+#ifdef __linux__
+    size_t filled = 0;
+    while (filled < size)
+    {
+        // Large requests may return early if interrupted by a signal; keep reading
+        const ssize_t result = ::getrandom(out + filled, size - filled, 0);
+        if (result < 0)
+        {
+            if (errno == EINTR) continue;
+            throw std::runtime_error("getrandom failed while filling the entropy pool.");
+        }
+        filled += static_cast<size_t>(result);
+    }
+#else
+    std::random_device device;
+    for (size_t i = 0; i < size; i += sizeof(unsigned int))
+    {
+        const unsigned int value = device();
+        std::memcpy(out + i, &value, std::min(sizeof(value), size - i));
+    }
+#endif
+}
+
+/// @brief Replaces the consumed buffer with a fresh block of at least size bytes (lock held)
+void Refill(size_t size)
+{
+    const size_t remaining = g_buffer.size() - g_cursor;
+    std::vector<uint8_t> block(remaining + std::max(size, EntropyPool::BLOCK_BYTES));
+
+    std::copy(g_buffer.begin() + g_cursor, g_buffer.end(), block.begin());
+    ReadSystemEntropy(block.data() + remaining, block.size() - remaining);
+
+    std::fill(g_buffer.begin(), g_buffer.end(), uint8_t{0});
+    g_buffer.swap(block);
+    g_cursor = 0;
+}
+
+#ifndef _WIN32
+// A forked child inherits the parent's unconsumed bytes; handing them out again would repeat the
+// parent's seeds. The mutex is held across fork() so the child never sees a half-served buffer.
+
+void LockBeforeFork() { g_mutex.lock(); }
+
+void UnlockInParent() { g_mutex.unlock(); }
+
+void DiscardInChild()
+{
+    std::fill(g_buffer.begin(), g_buffer.end(), uint8_t{0});
+    g_cursor = g_buffer.size();
+    g_generation.fetch_add(1, std::memory_order_relaxed);
+    g_mutex.unlock();
+}
+
+const bool g_forkHandlerRegistered = ::pthread_atfork(LockBeforeFork, UnlockInParent, DiscardInChild) == 0;
+#endif
+
+} // namespace
+
+// Public Fields
+
+// Constructors and Destructors
+
+// Public Methods
+
+void EntropyPool::Fill(void* out, size_t size)
+{
+    std::lock_guard<std::mutex> lock(g_mutex);
+    if (g_buffer.size() - g_cursor < size) Refill(size);
+
+    uint8_t* source = g_buffer.data() + g_cursor;
+    std::memcpy(out, source, size);
+    std::memset(source, 0, size); // Never hand out or keep the same bytes twice
+    g_cursor += size;
+}
+
+void EntropyPool::Reserve(size_t size)
+{
+    std::lock_guard<std::mutex> lock(g_mutex);
+    if (g_buffer.size() - g_cursor < size) Refill(size);
+}
+
+size_t EntropyPool::Available()
+{
+    std::lock_guard<std::mutex> lock(g_mutex);
+    return g_buffer.size() - g_cursor;
+}
+
+uint64_t EntropyPool::Generation()
+{
+    return g_generation.load(std::memory_order_relaxed);
+}
+
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+// Private Methods
+
+} // namespace velecs::common
@@ -0,0 +1,533 @@
+/// @file    EventRecorder.cpp
+/// @author  Matthew Green
+/// @date    2026-10-18 10:46:31
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/common/EventRecorder.hpp"
+
+#include "velecs/common/Paths.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#if defined(_M_X64)
+    #include <intrin.h>
+#elif defined(__x86_64__)
+    #include <x86intrin.h>
+#endif
+
+namespace velecs::common {
+
+namespace {
+
+/// @brief Magic bytes at the start of every per-thread log file
+constexpr char FILE_MAGIC[8] = { 'V', 'L', 'E', 'V', 'R', 'E', 'C', '1' };
+
+/// @brief Record header: stream id (u32), payload size (u32), timestamp in ticks (i64)
+constexpr size_t RECORD_HEADER_SIZE = sizeof(uint32_t) + sizeof(uint32_t) + sizeof(int64_t);
+
+/// @brief Buffered bytes after which a thread writes its records out
+constexpr size_t FLUSH_THRESHOLD = 256 * 1024;
+
+/// @brief Initial size of each thread's record buffer
+constexpr size_t BUFFER_CAPACITY = 2 * FLUSH_THRESHOLD;
+
+/// @brief Extension of per-thread log files
+constexpr const char* LOG_EXTENSION = ".vlrec";
+
+/// @brief Name of the file holding the session's timestamp rate
+constexpr const char* META_FILE_NAME = "session.meta";
+
+/// @brief Identifier of the active (or most recent) session; 0 before the first Start()
+std::atomic<uint64_t> g_session{0};
+
+/// @brief Tick counter value and steady_clock time at the start of the active session
+std::atomic<int64_t> g_sessionStartTicks{0};
+int64_t g_sessionStartNs{0};
+
+/// @brief Guards g_sessionDirectory, g_sessionStartNs and g_metaSession; never held while acquiring a thread log's lock
+std::mutex g_directoryMutex;
+std::filesystem::path g_sessionDirectory;
+
+/// @brief Session whose provisional tick rate has been written, so each session writes it once
+uint64_t g_metaSession{0};
+
+/// @brief Shortest baseline for the provisional tick rate; shorter ones are dominated by read skew
+constexpr int64_t MIN_CALIBRATION_NS = 1'000'000;
+
+int64_t SteadyNowNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/// @brief Reads the cheapest monotonic timestamp available
+/// @return Invariant TSC ticks on x86-64, steady_clock nanoseconds elsewhere
+int64_t ReadTicks()
+{
+#if defined(_M_X64) || defined(__x86_64__)
+    return static_cast<int64_t>(__rdtsc());
+#else
+    return SteadyNowNs();
+#endif
+}
+
+/// @brief Measures the tick rate against steady_clock since a reference point
+/// @param ticks0 ReadTicks() at the reference point
+/// @param ns0 SteadyNowNs() at the reference point
+/// @return Ticks per second
+double MeasureTicksPerSecond(int64_t ticks0, int64_t ns0)
+{
+#if defined(_M_X64) || defined(__x86_64__)
+    const int64_t elapsedNs = SteadyNowNs() - ns0;
+    const int64_t elapsedTicks = ReadTicks() - ticks0;
+    return elapsedNs > 0 ? static_cast<double>(elapsedTicks) * 1e9 / static_cast<double>(elapsedNs) : 1e9;
+#else
+    (void)ticks0;
+    (void)ns0;
+    return 1e9;
+#endif
+}
+
+/// @brief Writes the session's tick rate next to its logs
+/// @param sessionDir Session directory
+/// @param ticksPerSecond Tick rate to store
+void WriteSessionMeta(const std::filesystem::path& sessionDir, double ticksPerSecond)
+{
+    std::ofstream meta(sessionDir / META_FILE_NAME, std::ios::trunc);
+    meta.precision(17);
+    meta << "ticks_per_second " << ticksPerSecond << "\n";
+}
+
+/// @brief Writes a provisional tick rate the first time a session's records reach disk
+/// @param session Session the records belong to
+/// @details Measured from Start() to now without blocking anyone, so a session that crashes before Stop()
+///          can still be replayed. Stop() overwrites it with the rate over the whole session.
+void NoteSessionFlushed(uint64_t session)
+{
+    std::lock_guard<std::mutex> directoryLock(g_directoryMutex);
+    if (g_metaSession == session || g_session.load(std::memory_order_acquire) != session) return;
+    if (SteadyNowNs() - g_sessionStartNs < MIN_CALIBRATION_NS) return; // Try again on a later flush
+
+    WriteSessionMeta(g_sessionDirectory,
+        MeasureTicksPerSecond(g_sessionStartTicks.load(std::memory_order_relaxed), g_sessionStartNs));
+    g_metaSession = session;
+}
+
+/// @brief Buffered records and log file of one thread
+struct ThreadLog {
+    std::atomic_flag lock = ATOMIC_FLAG_INIT;
+    std::unique_ptr<uint8_t[]> storage;
+    size_t capacity{0};
+    size_t used{0};
+    std::FILE* file{nullptr};
+    uint64_t session{0};
+    uint32_t threadIndex{0};
+
+    void Lock() { while (lock.test_and_set(std::memory_order_acquire)) { std::this_thread::yield(); } }
+    void Unlock() { lock.clear(std::memory_order_release); }
+
+    /// @brief Switches the log to the current session, dropping records of an older session
+    /// @note Must be called with the log locked
+    void OpenForCurrentSession()
+    {
+        Close();
+        used = 0;
+        session = g_session.load(std::memory_order_acquire);
+
+        if (!storage)
+        {
+            storage = std::make_unique<uint8_t[]>(BUFFER_CAPACITY);
+            capacity = BUFFER_CAPACITY;
+        }
+
+        std::filesystem::path path;
+        {
+            std::lock_guard<std::mutex> directoryLock(g_directoryMutex);
+            path = g_sessionDirectory / ("thread-" + std::to_string(threadIndex) + LOG_EXTENSION);
+        }
+
+        file = std::fopen(path.string().c_str(), "wb");
+        if (file != nullptr)
+        {
+            std::fwrite(FILE_MAGIC, 1, sizeof(FILE_MAGIC), file);
+        }
+    }
+
+    /// @brief Writes the first count buffered bytes to the log file
+    /// @param count Number of bytes holding complete records
+    /// @note Must be called with the log locked. Records are dropped if the file could not be opened.
+    void WriteBytes(size_t count)
+    {
+        if (file != nullptr && count > 0)
+        {
+            std::fwrite(storage.get(), 1, count, file);
+            std::fflush(file);
+            NoteSessionFlushed(session);
+        }
+    }
+
+    /// @brief Writes all buffered records to the log file
+    /// @note Must be called with the log locked
+    void WriteOut()
+    {
+        WriteBytes(used);
+        used = 0;
+    }
+
+    /// @brief Writes buffered records and closes the log file
+    /// @note Must be called with the log locked
+    void Close()
+    {
+        WriteOut();
+        if (file != nullptr)
+        {
+            std::fclose(file);
+            file = nullptr;
+        }
+    }
+};
+
+/// @brief Every live thread's log, so Stop() can flush threads other than the caller
+struct LogRegistry {
+    std::mutex mutex;
+    std::vector<std::shared_ptr<ThreadLog>> logs;
+    std::atomic<uint32_t> nextThreadIndex{0};
+};
+
+LogRegistry& Registry()
+{
+    static LogRegistry registry;
+    return registry;
+}
+
+/// @brief The calling thread's log; a trivially initialized thread_local, so reading it needs no init guard
+thread_local ThreadLog* t_log = nullptr;
+
+/// @brief Owns the calling thread's log and flushes it when the thread exits
+struct ThreadLogOwner {
+    std::shared_ptr<ThreadLog> log;
+
+    ThreadLogOwner() : log(std::make_shared<ThreadLog>())
+    {
+        LogRegistry& registry = Registry();
+        log->threadIndex = registry.nextThreadIndex.fetch_add(1);
+
+        std::lock_guard<std::mutex> registryLock(registry.mutex);
+        registry.logs.push_back(log);
+    }
+
+    ~ThreadLogOwner()
+    {
+        t_log = nullptr;
+        log->Lock();
+        log->Close();
+        log->Unlock();
+
+        LogRegistry& registry = Registry();
+        std::lock_guard<std::mutex> registryLock(registry.mutex);
+        registry.logs.erase(std::remove(registry.logs.begin(), registry.logs.end(), log), registry.logs.end());
+    }
+};
+
+/// @brief Creates the calling thread's log on its first record
+ThreadLog& CreateThreadLog()
+{
+    static thread_local ThreadLogOwner owner;
+    t_log = owner.log.get();
+    return *t_log;
+}
+
+ThreadLog& CurrentThreadLog()
+{
+    return t_log != nullptr ? *t_log : CreateThreadLog();
+}
+
+template<typename T>
+T ReadRaw(const uint8_t* data)
+{
+    T value;
+    std::memcpy(&value, data, sizeof(T));
+    return value;
+}
+
+} // namespace
+
+// ----------------- EventRecordWriter -----------------
+
+EventRecordWriter::EventRecordWriter(uint32_t streamId)
+{
+    ThreadLog& log = CurrentThreadLog();
+    log.Lock();
+
+    if (log.session != g_session.load(std::memory_order_acquire))
+    {
+        log.OpenForCurrentSession();
+    }
+    if (log.capacity - log.used < RECORD_HEADER_SIZE)
+    {
+        log.WriteOut();
+    }
+
+    _log = &log;
+    _recordStart = log.storage.get() + log.used;
+    _cursor = _recordStart;
+    _end = log.storage.get() + log.capacity;
+
+    const int64_t timestamp = ReadTicks() - g_sessionStartTicks.load(std::memory_order_relaxed);
+    const uint32_t payloadSize = 0; // Patched on commit
+    std::memcpy(_cursor, &streamId, sizeof(streamId));
+    std::memcpy(_cursor + sizeof(uint32_t), &payloadSize, sizeof(payloadSize));
+    std::memcpy(_cursor + 2 * sizeof(uint32_t), &timestamp, sizeof(timestamp));
+    _cursor += RECORD_HEADER_SIZE;
+}
+
+EventRecordWriter::~EventRecordWriter()
+{
+    ThreadLog& log = *static_cast<ThreadLog*>(_log);
+
+    if (_committed)
+    {
+        const auto payloadSize = static_cast<uint32_t>(_cursor - _recordStart - RECORD_HEADER_SIZE);
+        std::memcpy(_recordStart + sizeof(uint32_t), &payloadSize, sizeof(payloadSize));
+
+        log.used = static_cast<size_t>(_cursor - log.storage.get());
+        if (log.used >= FLUSH_THRESHOLD)
+        {
+            log.WriteOut();
+        }
+    }
+    else
+    {
+        log.used = static_cast<size_t>(_recordStart - log.storage.get());
+    }
+
+    log.Unlock();
+}
+
+void EventRecordWriter::MakeRoom(size_t size)
+{
+    ThreadLog& log = *static_cast<ThreadLog*>(_log);
+
+    // Write out every complete record, then slide the partial record to the front
+    const size_t completeBytes = static_cast<size_t>(_recordStart - log.storage.get());
+    const size_t partialBytes = static_cast<size_t>(_cursor - _recordStart);
+    log.WriteBytes(completeBytes);
+
+    if (partialBytes + size > log.capacity)
+    {
+        const size_t newCapacity = std::max(log.capacity * 2, partialBytes + size);
+        auto newStorage = std::make_unique<uint8_t[]>(newCapacity);
+        std::memcpy(newStorage.get(), _recordStart, partialBytes);
+        log.storage = std::move(newStorage);
+        log.capacity = newCapacity;
+    }
+    else
+    {
+        std::memmove(log.storage.get(), _recordStart, partialBytes);
+    }
+
+    log.used = 0;
+    _recordStart = log.storage.get();
+    _cursor = _recordStart + partialBytes;
+    _end = log.storage.get() + log.capacity;
+}
+
+// ----------------- EventRecorder -----------------
+
+// Public Fields
+
+// Constructors and Destructors
+
+// Public Methods
+
+std::filesystem::path EventRecorder::Start(const std::filesystem::path& directory)
+{
+    LogRegistry& registry = Registry();
+    std::lock_guard<std::mutex> registryLock(registry.mutex);
+
+    if (IsRecording())
+        throw std::runtime_error("EventRecorder::Start() called while a session is already recording.");
+
+    const std::filesystem::path parent = directory.empty()
+        ? Paths::PersistentDataDir() / "EventRecordings"
+        : directory;
+
+    const auto wallMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    const std::filesystem::path sessionDir = parent / ("session-" + std::to_string(wallMs));
+
+    std::error_code error;
+    std::filesystem::create_directories(sessionDir, error);
+    if (error)
+        throw std::runtime_error("Unable to create event recording directory '" + sessionDir.string() + "': " + error.message());
+
+    // The tick rate is measured against this baseline at the first flush and again in Stop(),
+    // so Start() never waits for a calibration interval
+    {
+        std::lock_guard<std::mutex> directoryLock(g_directoryMutex);
+        g_sessionDirectory = sessionDir;
+        g_sessionStartTicks.store(ReadTicks(), std::memory_order_relaxed);
+        g_sessionStartNs = SteadyNowNs();
+    }
+    g_session.fetch_add(1, std::memory_order_release);
+    _recording.store(true, std::memory_order_release);
+
+    return sessionDir;
+}
+
+void EventRecorder::Stop()
+{
+    LogRegistry& registry = Registry();
+    std::lock_guard<std::mutex> registryLock(registry.mutex);
+
+    if (!IsRecording()) return;
+    _recording.store(false, std::memory_order_release);
+
+    for (const auto& log : registry.logs)
+    {
+        log->Lock();
+        log->Close();
+        log->Unlock();
+    }
+
+    std::lock_guard<std::mutex> directoryLock(g_directoryMutex);
+    WriteSessionMeta(g_sessionDirectory,
+        MeasureTicksPerSecond(g_sessionStartTicks.load(std::memory_order_relaxed), g_sessionStartNs));
+    g_metaSession = g_session.load(std::memory_order_relaxed);
+}
+
+void EventRecorder::Flush()
+{
+    ThreadLog& log = CurrentThreadLog();
+    log.Lock();
+    log.WriteOut();
+    log.Unlock();
+}
+
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+std::atomic<bool> EventRecorder::_recording{false};
+
+// Private Methods
+
+// ----------------- EventReplayer -----------------
+
+void EventReplayer::Load(const std::filesystem::path& path)
+{
+    if (std::filesystem::is_directory(path))
+    {
+        std::vector<std::filesystem::path> files;
+        for (const auto& entry : std::filesystem::directory_iterator(path))
+        {
+            if (entry.is_regular_file() && entry.path().extension() == LOG_EXTENSION)
+            {
+                files.push_back(entry.path());
+            }
+        }
+        std::sort(files.begin(), files.end());
+
+        const double ticksPerSecond = ReadTicksPerSecond(path);
+        for (const auto& file : files)
+        {
+            LoadFile(file, ticksPerSecond);
+        }
+    }
+    else
+    {
+        LoadFile(path, ReadTicksPerSecond(path.parent_path()));
+    }
+
+    std::stable_sort(_records.begin(), _records.end(), [](const Record& a, const Record& b) {
+        return a.timestampNs < b.timestampNs;
+    });
+}
+
+EventReplayer::ReplayStats EventReplayer::Run(Speed speed)
+{
+    ReplayStats stats;
+    if (_records.empty()) return stats;
+
+    const int64_t firstNs = _records.front().timestampNs;
+    stats.recordedSpan = std::chrono::nanoseconds(_records.back().timestampNs - firstNs);
+
+    const auto start = std::chrono::steady_clock::now();
+    for (const Record& record : _records)
+    {
+        auto binding = _bindings.find(record.streamId);
+        if (binding == _bindings.end())
+        {
+            ++stats.skipped;
+            continue;
+        }
+
+        if (speed == Speed::Original)
+        {
+            std::this_thread::sleep_until(start + std::chrono::nanoseconds(record.timestampNs - firstNs));
+        }
+
+        const uint8_t* payload = _files[record.file].data() + record.offset;
+        binding->second(payload, payload + record.size);
+        ++stats.invoked;
+    }
+    stats.elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+    return stats;
+}
+
+void EventReplayer::LoadFile(const std::filesystem::path& file, double ticksPerSecond)
+{
+    std::ifstream stream(file, std::ios::binary);
+    if (!stream)
+        throw std::runtime_error("Unable to open event recording '" + file.string() + "'.");
+
+    std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+    if (bytes.size() < sizeof(FILE_MAGIC) || std::memcmp(bytes.data(), FILE_MAGIC, sizeof(FILE_MAGIC)) != 0)
+        throw std::runtime_error("'" + file.string() + "' is not an event recording.");
+
+    const size_t fileIndex = _files.size();
+    size_t offset = sizeof(FILE_MAGIC);
+    while (bytes.size() - offset >= RECORD_HEADER_SIZE)
+    {
+        const uint8_t* header = bytes.data() + offset;
+        const auto streamId = ReadRaw<uint32_t>(header);
+        const auto payloadSize = ReadRaw<uint32_t>(header + sizeof(uint32_t));
+        const auto timestampTicks = ReadRaw<int64_t>(header + 2 * sizeof(uint32_t));
+        const auto timestampNs = static_cast<int64_t>(static_cast<double>(timestampTicks) * 1e9 / ticksPerSecond);
+
+        offset += RECORD_HEADER_SIZE;
+        if (bytes.size() - offset < payloadSize) break; // Truncated tail, e.g. from a crash
+
+        _records.push_back({ timestampNs, streamId, fileIndex, offset, payloadSize });
+        offset += payloadSize;
+    }
+
+    _files.push_back(std::move(bytes));
+}
+
+double EventReplayer::ReadTicksPerSecond(const std::filesystem::path& sessionDir)
+{
+    std::ifstream meta(sessionDir / META_FILE_NAME);
+    std::string key;
+    double ticksPerSecond = 0.0;
+    if (meta >> key >> ticksPerSecond && key == "ticks_per_second" && ticksPerSecond > 0.0)
+    {
+        return ticksPerSecond;
+    }
+    return 1e9;
+}
+
+} // namespace velecs::common
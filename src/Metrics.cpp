@@ -0,0 +1,341 @@
+/// @file    Metrics.cpp
+/// @author  Matthew Green
+/// @date    2026-10-18 20:06:38
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/common/Metrics.hpp"
+#include "velecs/common/MetricsExporter.hpp"
+#include "velecs/common/Paths.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <fstream>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <unordered_map>
+
+namespace velecs::common {
+
+namespace {
+
+enum class Kind { Counter, Gauge, Histogram };
+
+/// @brief Registry node; nodes are pushed at the head and never removed
+struct Entry {
+    Kind kind;
+    void* metric;
+    std::string name;
+    Entry* next;
+};
+
+/// @brief Intentionally leaked so metrics stay valid during static destruction
+struct Registry {
+    std::mutex mutex;
+    std::unordered_map<std::string, Entry*> byName;
+    std::atomic<Entry*> head{nullptr};
+
+    std::mutex exporterMutex;
+    std::condition_variable exporterCv;
+    std::thread exporter;
+    bool stopExporter{false};
+};
+
+Registry& GetRegistry()
+{
+    static Registry* registry = new Registry();
+    return *registry;
+}
+
+template<typename T>
+T& GetOrCreate(std::string_view name, Kind kind)
+{
+    Registry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    auto it = registry.byName.find(std::string(name));
+    if (it != registry.byName.end())
+    {
+        if (it->second->kind != kind)
+            throw std::runtime_error("Metric '" + std::string(name) + "' is already registered as a different kind.");
+        return *static_cast<T*>(it->second->metric);
+    }
+
+    T* metric = new T();
+    Entry* entry = new Entry{kind, metric, std::string(name), registry.head.load(std::memory_order_relaxed)};
+    registry.head.store(entry, std::memory_order_release);
+    registry.byName.emplace(name, entry);
+    return *metric;
+}
+
+void AppendJsonString(std::string& out, const std::string& text)
+{
+    out.push_back('"');
+    for (char c : text)
+    {
+        if (c == '"' || c == '\\')
+        {
+            out.push_back('\\');
+            out.push_back(c);
+        }
+        else if (static_cast<unsigned char>(c) < 0x20)
+        {
+            char escaped[8];
+            std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(c));
+            out += escaped;
+        }
+        else
+        {
+            out.push_back(c);
+        }
+    }
+    out.push_back('"');
+}
+
+void ExporterLoop(std::chrono::milliseconds interval, MetricsExporter::Format format, std::filesystem::path path)
+{
+    Registry& registry = GetRegistry();
+    std::unique_lock<std::mutex> lock(registry.exporterMutex);
+    while (true)
+    {
+        const bool stopping = registry.exporterCv.wait_for(lock, interval, [&registry] { return registry.stopExporter; });
+
+        lock.unlock();
+        try
+        {
+            MetricsExporter::WriteSnapshot(path, format);
+        }
+        catch (const std::exception&)
+        {
+            // A full disk or removed directory must not take the process down; retry next interval
+        }
+        lock.lock();
+
+        if (stopping) return;
+    }
+}
+
+} // namespace
+
+// Public Fields
+
+// Constructors and Destructors
+
+// Public Methods
+
+uint64_t Counter::Value() const noexcept
+{
+    uint64_t total = 0;
+    for (const Cell& cell : _cells)
+    {
+        total += cell.value.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+uint64_t Histogram::ValueAtQuantile(double quantile) const noexcept
+{
+    uint64_t count = 0;
+    for (const auto& bucket : _buckets) count += bucket.load(std::memory_order_relaxed);
+    if (count == 0) return 0;
+
+    const uint64_t rank = quantile <= 0.0 ? 1 : static_cast<uint64_t>(quantile * static_cast<double>(count) + 0.5);
+    uint64_t seen = 0;
+    for (size_t i = 0; i < BUCKET_COUNT; ++i)
+    {
+        seen += _buckets[i].load(std::memory_order_relaxed);
+        if (seen >= rank && seen > 0) return BucketUpperBound(i);
+    }
+    return _max.load(std::memory_order_relaxed);
+}
+
+Histogram::Snapshot Histogram::TakeSnapshot() const noexcept
+{
+    std::array<uint64_t, BUCKET_COUNT> counts;
+    Snapshot snapshot;
+    for (size_t i = 0; i < BUCKET_COUNT; ++i)
+    {
+        counts[i] = _buckets[i].load(std::memory_order_relaxed);
+        snapshot.count += counts[i];
+    }
+    snapshot.sum = _sum.load(std::memory_order_relaxed);
+    snapshot.max = _max.load(std::memory_order_relaxed);
+    if (snapshot.count == 0) return snapshot;
+
+    const double quantiles[] = {0.5, 0.9, 0.99, 0.999};
+    uint64_t* outputs[] = {&snapshot.p50, &snapshot.p90, &snapshot.p99, &snapshot.p999};
+
+    size_t next = 0;
+    uint64_t seen = 0;
+    for (size_t i = 0; i < BUCKET_COUNT && next < 4; ++i)
+    {
+        seen += counts[i];
+        while (next < 4 && seen >= static_cast<uint64_t>(quantiles[next] * static_cast<double>(snapshot.count) + 0.5) && seen > 0)
+        {
+            // The bucket bound can overshoot the largest value actually seen
+            *outputs[next++] = std::min(BucketUpperBound(i), snapshot.max);
+        }
+    }
+    return snapshot;
+}
+
+Counter& Metrics::GetCounter(std::string_view name)
+{
+    return GetOrCreate<Counter>(name, Kind::Counter);
+}
+
+Gauge& Metrics::GetGauge(std::string_view name)
+{
+    return GetOrCreate<Gauge>(name, Kind::Gauge);
+}
+
+Histogram& Metrics::GetHistogram(std::string_view name)
+{
+    return GetOrCreate<Histogram>(name, Kind::Histogram);
+}
+
+uint64_t Metrics::NowNs() noexcept
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+std::atomic<bool> Metrics::_enabled{true};
+std::atomic<size_t> Metrics::_nextShard{0};
+
+// Private Methods
+
+// ----------------- MetricsExporter -----------------
+
+std::string MetricsExporter::Snapshot(Format format)
+{
+    std::string out;
+    const bool json = format == Format::Json;
+    if (json) out += "{";
+
+    bool first = true;
+    auto appendValue = [&](const std::string& name, const std::string& value) {
+        if (json)
+        {
+            out += first ? "\n  " : ",\n  ";
+            AppendJsonString(out, name);
+            out += ": " + value;
+        }
+        else
+        {
+            out += name + " " + value + "\n";
+        }
+        first = false;
+    };
+
+    // Lock-free walk: entries are immutable once published and never freed
+    for (const Entry* entry = GetRegistry().head.load(std::memory_order_acquire); entry != nullptr; entry = entry->next)
+    {
+        switch (entry->kind)
+        {
+        case Kind::Counter:
+        {
+            const Counter& counter = *static_cast<const Counter*>(entry->metric);
+            appendValue(entry->name, std::to_string(counter.Value()));
+            break;
+        }
+        case Kind::Gauge:
+        {
+            const Gauge& gauge = *static_cast<const Gauge*>(entry->metric);
+            appendValue(entry->name, std::to_string(gauge.Value()));
+            break;
+        }
+        case Kind::Histogram:
+        {
+            const Histogram& histogram = *static_cast<const Histogram*>(entry->metric);
+            const Histogram::Snapshot s = histogram.TakeSnapshot();
+            if (json)
+            {
+                appendValue(entry->name,
+                    "{\"count\": " + std::to_string(s.count) + ", \"sum\": " + std::to_string(s.sum) +
+                    ", \"max\": " + std::to_string(s.max) + ", \"p50\": " + std::to_string(s.p50) +
+                    ", \"p90\": " + std::to_string(s.p90) + ", \"p99\": " + std::to_string(s.p99) +
+                    ", \"p999\": " + std::to_string(s.p999) + "}");
+            }
+            else
+            {
+                const std::string& name = entry->name;
+                appendValue(name + ".count", std::to_string(s.count));
+                appendValue(name + ".sum", std::to_string(s.sum));
+                appendValue(name + ".max", std::to_string(s.max));
+                appendValue(name + ".p50", std::to_string(s.p50));
+                appendValue(name + ".p90", std::to_string(s.p90));
+                appendValue(name + ".p99", std::to_string(s.p99));
+                appendValue(name + ".p999", std::to_string(s.p999));
+            }
+            break;
+        }
+        }
+    }
+
+    if (json) out += first ? "}\n" : "\n}\n";
+    return out;
+}
+
+void MetricsExporter::WriteSnapshot(const std::filesystem::path& path, Format format)
+{
+    const std::string snapshot = Snapshot(format);
+
+    std::filesystem::path temp = path;
+    temp += ".tmp";
+    {
+        std::ofstream file(temp, std::ios::binary | std::ios::trunc);
+        if (!file.write(snapshot.data(), static_cast<std::streamsize>(snapshot.size())))
+            throw std::runtime_error("Failed to write metrics snapshot '" + temp.string() + "'.");
+    }
+    std::filesystem::rename(temp, path);
+}
+
+void MetricsExporter::Start(std::chrono::milliseconds interval, Format format)
+{
+    std::filesystem::path path = ExportPath(format);
+    std::filesystem::create_directories(path.parent_path());
+
+    Registry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.exporterMutex);
+    if (registry.exporter.joinable())
+        throw std::runtime_error("MetricsExporter::Start() called while the exporter is already running.");
+
+    registry.stopExporter = false;
+    registry.exporter = std::thread(ExporterLoop, interval, format, std::move(path));
+}
+
+void MetricsExporter::Stop()
+{
+    Registry& registry = GetRegistry();
+    std::thread exporter;
+    {
+        std::lock_guard<std::mutex> lock(registry.exporterMutex);
+        if (!registry.exporter.joinable()) return;
+        registry.stopExporter = true;
+        exporter = std::move(registry.exporter);
+    }
+    registry.exporterCv.notify_all();
+    exporter.join();
+}
+
+std::filesystem::path MetricsExporter::ExportPath(Format format)
+{
+    return Paths::PersistentDataDir() / "Metrics" / (format == Format::Json ? "metrics.json" : "metrics.txt");
+}
+
+} // namespace velecs::common
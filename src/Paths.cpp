@@ -12,8 +12,41 @@
 
 #include "SDL3/SDL_filesystem.h"
 
+#include <vector>
+
+#ifndef _WIN32
+#include <cerrno>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 namespace velecs::common {
 
+namespace {
+
+#ifndef _WIN32
+/// @brief Creates root/components... as directories private to the current user
+/// @return The full path, or an empty path if any component exists but is not a real directory owned by this user
+/// @details Shared roots such as /dev/shm let other users pre-create or symlink a predictable name, so every
+///          component is created 0700 and checked with lstat() rather than trusted because is_directory() says so.
+std::filesystem::path CreatePrivateDirectories(std::filesystem::path path, const std::vector<std::string>& components)
+{
+    for (const std::string& component : components)
+    {
+        path /= component;
+        if (::mkdir(path.c_str(), 0700) != 0 && errno != EEXIST) return {};
+
+        struct stat info;
+        if (::lstat(path.c_str(), &info) != 0) return {};
+        if (!S_ISDIR(info.st_mode) || info.st_uid != ::getuid()) return {};
+        if ((info.st_mode & 077) != 0 && ::chmod(path.c_str(), 0700) != 0) return {};
+    }
+    return path;
+}
+#endif
+
+} // namespace
+
 // Public Fields
 
 // Constructors and Destructors
@@ -30,6 +63,10 @@ void Paths::Init(const std::string& company, const std::string& appTitle)
 
     _persistentDataDir = CreateAndGetPersistentDirPath(company, appTitle);
 
+    // Cache directories are created by the first CacheDir() call, so apps without caches never make them
+    _company = company;
+    _appTitle = appTitle;
+
     _initialized = true;
 }
 
@@ -56,7 +93,7 @@ std::optional<std::string> Paths::GetEnvironmentVariable(const std::string& name
 #else
     // Use standard C function for other platforms
     const char* value = std::getenv(name.c_str());
-    return value ? std::string(value) : std::nullopt;
+    return value ? std::optional<std::string>(value) : std::nullopt;
 #endif
 }
 
@@ -82,6 +119,21 @@ const std::filesystem::path& Paths::PersistentDataDir()
     return _persistentDataDir;
 }
 
+// ----------------- Cache directories -----------------
+
+const std::filesystem::path& Paths::CacheDir(CacheTier tier)
+{
+    CheckIfInitialized();
+    std::call_once(_cacheDirsOnce, [] {
+        _durableCacheDir = _persistentDataDir / "Cache";
+        std::filesystem::create_directories(_durableCacheDir);
+
+        _fastCacheDir = CreateAndGetFastCacheDirPath(_company, _appTitle);
+        if (_fastCacheDir.empty()) _fastCacheDir = _durableCacheDir;
+    });
+    return tier == CacheTier::Fast ? _fastCacheDir : _durableCacheDir;
+}
+
 // Protected Fields
 
 // Protected Methods
@@ -95,6 +147,13 @@ std::filesystem::path Paths::_assetsDir;
 
 std::filesystem::path Paths::_persistentDataDir;
 
+std::string Paths::_company;
+std::string Paths::_appTitle;
+std::once_flag Paths::_cacheDirsOnce;
+
+std::filesystem::path Paths::_fastCacheDir;
+std::filesystem::path Paths::_durableCacheDir;
+
 // Private Methods
 
 void Paths::CheckIfInitialized()
@@ -130,4 +189,27 @@ std::filesystem::path Paths::CreateAndGetPersistentDirPath(const std::string& co
     return persistentDataDir;
 }
 
+std::filesystem::path Paths::CreateAndGetFastCacheDirPath(const std::string& company, const std::string& appTitle)
+{
+#ifdef _WIN32
+    auto temp = GetEnvironmentVariable("TEMP");
+    if (!temp.has_value()) return {};
+
+    const std::filesystem::path candidate = std::filesystem::path(temp.value()) / company / appTitle / "Cache";
+    std::error_code error;
+    std::filesystem::create_directories(candidate, error);
+    return !error && std::filesystem::is_directory(candidate, error) ? candidate : std::filesystem::path{};
+#else
+    auto runtimeDir = GetEnvironmentVariable("XDG_RUNTIME_DIR");
+    if (runtimeDir.has_value() && !runtimeDir->empty())
+    {
+        std::filesystem::path dir = CreatePrivateDirectories(runtimeDir.value(), {company, appTitle, "Cache"});
+        if (!dir.empty()) return dir;
+    }
+
+    // Per-user name, since /dev/shm is shared by every user on the machine
+    return CreatePrivateDirectories("/dev/shm", {company + "-" + appTitle + "-" + std::to_string(::getuid()), "Cache"});
+#endif
+}
+
 } // namespace velecs::common
@@ -0,0 +1,340 @@
+/// @file    RoaringBitmap.cpp
+/// @author  Matthew Green
+/// @date    2026-10-18 18:27:13
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/common/RoaringBitmap.hpp"
+
+#include <algorithm>
+#include <iterator>
+
+namespace velecs::common {
+
+namespace {
+
+uint16_t High(uint32_t value) { return static_cast<uint16_t>(value >> 16); }
+uint16_t Low(uint32_t value) { return static_cast<uint16_t>(value & 0xFFFF); }
+
+void SetBit(std::vector<uint64_t>& bits, uint16_t low) { bits[low >> 6] |= uint64_t{1} << (low & 63); }
+void ClearBit(std::vector<uint64_t>& bits, uint16_t low) { bits[low >> 6] &= ~(uint64_t{1} << (low & 63)); }
+bool TestBit(const std::vector<uint64_t>& bits, uint16_t low) { return (bits[low >> 6] >> (low & 63)) & 1; }
+
+uint32_t CountBits(const std::vector<uint64_t>& bits)
+{
+    uint32_t count = 0;
+    for (uint64_t word : bits) count += PopCount(word);
+    return count;
+}
+
+} // namespace
+
+// Public Fields
+
+// Constructors and Destructors
+
+// Public Methods
+
+bool RoaringBitmap::Add(uint32_t value)
+{
+    auto it = std::lower_bound(_chunks.begin(), _chunks.end(), High(value),
+        [](const Chunk& chunk, uint16_t key) { return chunk.key < key; });
+    if (it == _chunks.end() || it->key != High(value))
+    {
+        it = _chunks.insert(it, Chunk{});
+        it->key = High(value);
+    }
+
+    Chunk& chunk = *it;
+    const uint16_t low = Low(value);
+    if (chunk.IsBitmap())
+    {
+        if (TestBit(chunk.bits, low)) return false;
+        SetBit(chunk.bits, low);
+    }
+    else
+    {
+        auto pos = std::lower_bound(chunk.array.begin(), chunk.array.end(), low);
+        if (pos != chunk.array.end() && *pos == low) return false;
+        chunk.array.insert(pos, low);
+    }
+    ++chunk.cardinality;
+    chunk.Normalize();
+    return true;
+}
+
+void RoaringBitmap::AddRange(uint32_t begin, uint32_t end)
+{
+    for (uint64_t value = begin; value < end; ++value)
+    {
+        Add(static_cast<uint32_t>(value));
+    }
+}
+
+bool RoaringBitmap::Remove(uint32_t value)
+{
+    auto it = std::lower_bound(_chunks.begin(), _chunks.end(), High(value),
+        [](const Chunk& chunk, uint16_t key) { return chunk.key < key; });
+    if (it == _chunks.end() || it->key != High(value)) return false;
+
+    Chunk& chunk = *it;
+    const uint16_t low = Low(value);
+    if (chunk.IsBitmap())
+    {
+        if (!TestBit(chunk.bits, low)) return false;
+        ClearBit(chunk.bits, low);
+    }
+    else
+    {
+        auto pos = std::lower_bound(chunk.array.begin(), chunk.array.end(), low);
+        if (pos == chunk.array.end() || *pos != low) return false;
+        chunk.array.erase(pos);
+    }
+
+    if (--chunk.cardinality == 0)
+    {
+        _chunks.erase(it);
+    }
+    else
+    {
+        chunk.Normalize();
+    }
+    return true;
+}
+
+bool RoaringBitmap::Contains(uint32_t value) const
+{
+    auto it = std::lower_bound(_chunks.begin(), _chunks.end(), High(value),
+        [](const Chunk& chunk, uint16_t key) { return chunk.key < key; });
+    return it != _chunks.end() && it->key == High(value) && it->Contains(Low(value));
+}
+
+uint64_t RoaringBitmap::Cardinality() const
+{
+    uint64_t count = 0;
+    for (const Chunk& chunk : _chunks) count += chunk.cardinality;
+    return count;
+}
+
+std::vector<uint32_t> RoaringBitmap::ToVector() const
+{
+    std::vector<uint32_t> values;
+    values.reserve(static_cast<size_t>(Cardinality()));
+    ForEach([&values](uint32_t value) { values.push_back(value); });
+    return values;
+}
+
+RoaringBitmap RoaringBitmap::And(const RoaringBitmap& a, const RoaringBitmap& b)
+{
+    RoaringBitmap result;
+    auto ia = a._chunks.begin();
+    auto ib = b._chunks.begin();
+    while (ia != a._chunks.end() && ib != b._chunks.end())
+    {
+        if (ia->key < ib->key) { ++ia; continue; }
+        if (ib->key < ia->key) { ++ib; continue; }
+
+        Chunk chunk = AndChunks(*ia, *ib);
+        if (chunk.cardinality != 0) result._chunks.push_back(std::move(chunk));
+        ++ia;
+        ++ib;
+    }
+    return result;
+}
+
+RoaringBitmap RoaringBitmap::Or(const RoaringBitmap& a, const RoaringBitmap& b)
+{
+    RoaringBitmap result;
+    result._chunks.reserve(std::max(a._chunks.size(), b._chunks.size()));
+    auto ia = a._chunks.begin();
+    auto ib = b._chunks.begin();
+    while (ia != a._chunks.end() || ib != b._chunks.end())
+    {
+        if (ib == b._chunks.end() || (ia != a._chunks.end() && ia->key < ib->key))
+        {
+            result._chunks.push_back(*ia++);
+        }
+        else if (ia == a._chunks.end() || ib->key < ia->key)
+        {
+            result._chunks.push_back(*ib++);
+        }
+        else
+        {
+            result._chunks.push_back(OrChunks(*ia++, *ib++));
+        }
+    }
+    return result;
+}
+
+RoaringBitmap RoaringBitmap::AndNot(const RoaringBitmap& a, const RoaringBitmap& b)
+{
+    RoaringBitmap result;
+    auto ib = b._chunks.begin();
+    for (const Chunk& chunk : a._chunks)
+    {
+        while (ib != b._chunks.end() && ib->key < chunk.key) ++ib;
+
+        if (ib == b._chunks.end() || ib->key != chunk.key)
+        {
+            result._chunks.push_back(chunk);
+            continue;
+        }
+
+        Chunk difference = AndNotChunks(chunk, *ib);
+        if (difference.cardinality != 0) result._chunks.push_back(std::move(difference));
+    }
+    return result;
+}
+
+bool RoaringBitmap::operator==(const RoaringBitmap& other) const
+{
+    if (_chunks.size() != other._chunks.size()) return false;
+    for (size_t i = 0; i < _chunks.size(); ++i)
+    {
+        // Normalize keeps the representation a function of the contents, so members compare directly
+        const Chunk& a = _chunks[i];
+        const Chunk& b = other._chunks[i];
+        if (a.key != b.key || a.cardinality != b.cardinality || a.array != b.array || a.bits != b.bits) return false;
+    }
+    return true;
+}
+
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+// Private Methods
+
+bool RoaringBitmap::Chunk::Contains(uint16_t low) const
+{
+    if (IsBitmap()) return TestBit(bits, low);
+    return std::binary_search(array.begin(), array.end(), low);
+}
+
+void RoaringBitmap::Chunk::Normalize()
+{
+    if (IsBitmap() && cardinality <= ARRAY_CHUNK_LIMIT)
+    {
+        array.clear();
+        array.reserve(cardinality);
+        for (uint32_t w = 0; w < BITMAP_WORDS; ++w)
+        {
+            ForEachSetBit(bits[w], w * 64, [this](uint64_t value) { array.push_back(static_cast<uint16_t>(value)); });
+        }
+        std::vector<uint64_t>().swap(bits);
+    }
+    else if (!IsBitmap() && cardinality > ARRAY_CHUNK_LIMIT)
+    {
+        bits.assign(BITMAP_WORDS, 0);
+        for (uint16_t low : array) SetBit(bits, low);
+        std::vector<uint16_t>().swap(array);
+    }
+}
+
+RoaringBitmap::Chunk RoaringBitmap::AndChunks(const Chunk& a, const Chunk& b)
+{
+    Chunk result;
+    result.key = a.key;
+
+    if (a.IsBitmap() && b.IsBitmap())
+    {
+        result.bits.resize(BITMAP_WORDS);
+        for (uint32_t w = 0; w < BITMAP_WORDS; ++w) result.bits[w] = a.bits[w] & b.bits[w];
+        result.cardinality = CountBits(result.bits);
+    }
+    else if (a.IsBitmap() || b.IsBitmap())
+    {
+        const Chunk& sparse = a.IsBitmap() ? b : a;
+        const Chunk& dense = a.IsBitmap() ? a : b;
+        for (uint16_t low : sparse.array)
+        {
+            if (TestBit(dense.bits, low)) result.array.push_back(low);
+        }
+        result.cardinality = static_cast<uint32_t>(result.array.size());
+    }
+    else
+    {
+        std::set_intersection(a.array.begin(), a.array.end(), b.array.begin(), b.array.end(),
+            std::back_inserter(result.array));
+        result.cardinality = static_cast<uint32_t>(result.array.size());
+    }
+
+    result.Normalize();
+    return result;
+}
+
+RoaringBitmap::Chunk RoaringBitmap::OrChunks(const Chunk& a, const Chunk& b)
+{
+    Chunk result;
+    result.key = a.key;
+
+    if (!a.IsBitmap() && !b.IsBitmap())
+    {
+        result.array.reserve(a.array.size() + b.array.size());
+        std::set_union(a.array.begin(), a.array.end(), b.array.begin(), b.array.end(),
+            std::back_inserter(result.array));
+        result.cardinality = static_cast<uint32_t>(result.array.size());
+    }
+    else
+    {
+        result.bits = a.IsBitmap() ? a.bits : b.bits;
+        const Chunk& other = a.IsBitmap() ? b : a;
+        if (other.IsBitmap())
+        {
+            for (uint32_t w = 0; w < BITMAP_WORDS; ++w) result.bits[w] |= other.bits[w];
+        }
+        else
+        {
+            for (uint16_t low : other.array) SetBit(result.bits, low);
+        }
+        result.cardinality = CountBits(result.bits);
+    }
+
+    result.Normalize();
+    return result;
+}
+
+RoaringBitmap::Chunk RoaringBitmap::AndNotChunks(const Chunk& a, const Chunk& b)
+{
+    Chunk result;
+    result.key = a.key;
+
+    if (a.IsBitmap())
+    {
+        result.bits = a.bits;
+        if (b.IsBitmap())
+        {
+            for (uint32_t w = 0; w < BITMAP_WORDS; ++w) result.bits[w] &= ~b.bits[w];
+        }
+        else
+        {
+            for (uint16_t low : b.array) ClearBit(result.bits, low);
+        }
+        result.cardinality = CountBits(result.bits);
+    }
+    else if (b.IsBitmap())
+    {
+        for (uint16_t low : a.array)
+        {
+            if (!TestBit(b.bits, low)) result.array.push_back(low);
+        }
+        result.cardinality = static_cast<uint32_t>(result.array.size());
+    }
+    else
+    {
+        std::set_difference(a.array.begin(), a.array.end(), b.array.begin(), b.array.end(),
+            std::back_inserter(result.array));
+        result.cardinality = static_cast<uint32_t>(result.array.size());
+    }
+
+    result.Normalize();
+    return result;
+}
+
+} // namespace velecs::common
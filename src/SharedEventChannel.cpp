@@ -0,0 +1,400 @@
+/// @file    SharedEventChannel.cpp
+/// @author  Matthew Green
+/// @date    2026-10-18 12:44:27
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/common/SharedEventChannel.hpp"
+#include "velecs/common/Exceptions.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <random>
+#include <stdexcept>
+#include <thread>
+
+#ifdef __linux__
+#include <cerrno>
+#include <ctime>
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace velecs::common {
+
+namespace {
+
+constexpr uint32_t CHANNEL_MAGIC = 0x56454243; // "VEBC"
+constexpr uint32_t CHANNEL_VERSION = 1;
+constexpr size_t CACHE_LINE = 64;
+
+/// @brief Yields a publisher waits for the previous lap's writer before taking its slot over
+constexpr int CLAIM_SPINS = 1024;
+
+/// @brief How long a reader waits on an unfinished ticket while later tickets exist before
+/// treating its publisher as dead or descheduled and skipping it
+constexpr std::chrono::milliseconds STUCK_WRITER_TIMEOUT{100};
+
+/// @brief Shared segment header, followed by the slot array
+struct ChannelHeader {
+    std::atomic<uint32_t> magic;
+    uint32_t version;
+    uint32_t slotCount;
+    uint32_t slotPayload;
+    alignas(CACHE_LINE) std::atomic<uint64_t> head;
+    alignas(CACHE_LINE) std::atomic<uint32_t> wakeSequence;
+    std::atomic<uint32_t> sleepers;
+};
+
+/// @brief Per-slot header, followed by the payload bytes.
+/// @details seq is 2t+1 while ticket t is being written and 2t+2 once it is complete. It only moves
+/// forward: writers claim and complete slots with compare-and-swap.
+struct SlotHeader {
+    std::atomic<uint64_t> seq;
+    uint64_t senderId;
+    uint32_t eventId;
+    uint32_t size;
+};
+
+static_assert(std::atomic<uint32_t>::is_always_lock_free && std::atomic<uint64_t>::is_always_lock_free,
+    "Shared-memory atomics must be lock free to work across processes.");
+
+constexpr size_t SLOTS_OFFSET = (sizeof(ChannelHeader) + CACHE_LINE - 1) / CACHE_LINE * CACHE_LINE;
+
+size_t SlotStride(uint32_t slotPayload)
+{
+    return (sizeof(SlotHeader) + slotPayload + CACHE_LINE - 1) / CACHE_LINE * CACHE_LINE;
+}
+
+std::string ShmName(const std::string& name)
+{
+    if (name.empty() || name.find('/') != std::string::npos)
+        throw std::invalid_argument("SharedEventChannel name must be non-empty and contain no '/'.");
+    return "/" + name;
+}
+
+uint64_t MakeSenderId()
+{
+    std::random_device device;
+    uint64_t id = (static_cast<uint64_t>(device()) << 32) | device();
+#ifdef __linux__
+    id ^= static_cast<uint64_t>(::getpid());
+#endif
+    return id == 0 ? 1 : id;
+}
+
+ChannelHeader* Header(void* mapping)
+{
+    return static_cast<ChannelHeader*>(mapping);
+}
+
+#ifdef __linux__
+void FutexWait(std::atomic<uint32_t>* word, uint32_t expected, std::chrono::microseconds timeout)
+{
+    timespec ts{};
+    ts.tv_sec = static_cast<time_t>(timeout.count() / 1000000);
+    ts.tv_nsec = static_cast<long>((timeout.count() % 1000000) * 1000);
+    ::syscall(SYS_futex, reinterpret_cast<uint32_t*>(word), FUTEX_WAIT, expected, &ts, nullptr, 0);
+}
+
+void FutexWakeAll(std::atomic<uint32_t>* word)
+{
+    ::syscall(SYS_futex, reinterpret_cast<uint32_t*>(word), FUTEX_WAKE, INT32_MAX, nullptr, nullptr, 0);
+}
+#endif
+
+} // namespace
+
+// Public Fields
+
+// Constructors and Destructors
+
+SharedEventChannel::SharedEventChannel(const std::string& name, uint32_t slotCount, uint32_t slotPayload)
+{
+#ifdef __linux__
+    if (slotCount == 0 || slotPayload == 0)
+        throw std::invalid_argument("SharedEventChannel needs at least one slot with a non-zero payload.");
+
+    const std::string shmName = ShmName(name);
+
+    bool creator = true;
+    _fd = ::shm_open(shmName.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (_fd < 0 && errno == EEXIST)
+    {
+        creator = false;
+        _fd = ::shm_open(shmName.c_str(), O_RDWR, 0600);
+    }
+    if (_fd < 0)
+        throw std::runtime_error("Failed to open shared memory for channel '" + name + "'.");
+
+    if (creator)
+    {
+        _mappingSize = SLOTS_OFFSET + SlotStride(slotPayload) * slotCount;
+        if (::ftruncate(_fd, static_cast<off_t>(_mappingSize)) != 0)
+        {
+            ::close(_fd);
+            ::shm_unlink(shmName.c_str());
+            throw std::runtime_error("Failed to size shared memory for channel '" + name + "'.");
+        }
+    }
+    else
+    {
+        // The creator sizes the segment right after creating it; wait for that to become visible.
+        struct stat info{};
+        for (int attempt = 0; attempt < 1000; ++attempt)
+        {
+            if (::fstat(_fd, &info) == 0 && static_cast<size_t>(info.st_size) >= SLOTS_OFFSET) break;
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        if (static_cast<size_t>(info.st_size) < SLOTS_OFFSET)
+        {
+            ::close(_fd);
+            throw std::runtime_error("Shared memory for channel '" + name + "' was never initialized.");
+        }
+        _mappingSize = static_cast<size_t>(info.st_size);
+    }
+
+    _mapping = ::mmap(nullptr, _mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, _fd, 0);
+    if (_mapping == MAP_FAILED)
+    {
+        _mapping = nullptr;
+        ::close(_fd);
+        throw std::runtime_error("Failed to map shared memory for channel '" + name + "'.");
+    }
+
+    ChannelHeader* header = Header(_mapping);
+    if (creator)
+    {
+        // ftruncate zero-fills, so every atomic already holds 0; publish the layout last.
+        header->version = CHANNEL_VERSION;
+        header->slotCount = slotCount;
+        header->slotPayload = slotPayload;
+        header->magic.store(CHANNEL_MAGIC, std::memory_order_release);
+    }
+    else
+    {
+        for (int attempt = 0; attempt < 1000 && header->magic.load(std::memory_order_acquire) != CHANNEL_MAGIC; ++attempt)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+        if (header->magic.load(std::memory_order_acquire) != CHANNEL_MAGIC || header->version != CHANNEL_VERSION
+            || SLOTS_OFFSET + SlotStride(header->slotPayload) * header->slotCount > _mappingSize)
+        {
+            ::munmap(_mapping, _mappingSize);
+            ::close(_fd);
+            throw std::runtime_error("Shared memory for channel '" + name + "' has an incompatible layout.");
+        }
+    }
+
+    _slotCount = header->slotCount;
+    _slotPayload = header->slotPayload;
+    _slotStride = SlotStride(_slotPayload);
+    _readTicket = header->head.load(std::memory_order_acquire);
+    _senderId = MakeSenderId();
+    _scratch.resize(_slotPayload);
+#else
+    (void)name;
+    (void)slotCount;
+    (void)slotPayload;
+    throw NotImplementedException("SharedEventChannel is only implemented on Linux.");
+#endif
+}
+
+SharedEventChannel::~SharedEventChannel()
+{
+#ifdef __linux__
+    if (_mapping != nullptr) ::munmap(_mapping, _mappingSize);
+    if (_fd >= 0) ::close(_fd);
+#endif
+}
+
+// Public Methods
+
+void SharedEventChannel::Unlink(const std::string& name)
+{
+#ifdef __linux__
+    ::shm_unlink(ShmName(name).c_str());
+#else
+    (void)name;
+#endif
+}
+
+void SharedEventChannel::Publish(uint32_t eventId, const void* data, size_t size)
+{
+    if (size > _slotPayload)
+        throw std::length_error("SharedEventChannel payload exceeds the slot capacity.");
+
+    ChannelHeader* header = Header(_mapping);
+    const uint64_t ticket = header->head.fetch_add(1, std::memory_order_acq_rel);
+
+    uint8_t* slotBytes = static_cast<uint8_t*>(_mapping) + SLOTS_OFFSET + (ticket % _slotCount) * _slotStride;
+    SlotHeader* slot = reinterpret_cast<SlotHeader*>(slotBytes);
+
+    // Claim the slot from whatever older ticket it holds. An odd seq means that ticket's writer is
+    // still copying; give it a moment, then take over in case it died. If a newer ticket already owns
+    // the slot, this writer was lapped while descheduled and its message is dropped.
+    uint64_t claimed = 2 * ticket + 1;
+    uint64_t seq = slot->seq.load(std::memory_order_relaxed);
+    for (int spin = 0; ; ++spin)
+    {
+        if (seq >= claimed) return;
+        if (seq % 2 == 1 && spin < CLAIM_SPINS)
+        {
+            std::this_thread::yield();
+            seq = slot->seq.load(std::memory_order_relaxed);
+            continue;
+        }
+        if (slot->seq.compare_exchange_weak(seq, claimed, std::memory_order_relaxed)) break;
+    }
+    std::atomic_thread_fence(std::memory_order_release);
+
+    slot->senderId = _senderId;
+    slot->eventId = eventId;
+    slot->size = static_cast<uint32_t>(size);
+    if (size > 0) std::memcpy(slotBytes + sizeof(SlotHeader), data, size);
+
+    // Fails only if a later lap took the slot over meanwhile; never move seq backwards
+    if (!slot->seq.compare_exchange_strong(claimed, 2 * ticket + 2, std::memory_order_release, std::memory_order_relaxed))
+        return;
+
+#ifdef __linux__
+    // Pairs with the sleeper registration in WaitAndPoll: either the sleeper sees the new
+    // wake sequence and does not block, or this side sees the sleeper and wakes it.
+    header->wakeSequence.fetch_add(1, std::memory_order_seq_cst);
+    if (header->sleepers.load(std::memory_order_seq_cst) != 0)
+        FutexWakeAll(&header->wakeSequence);
+#endif
+}
+
+void SharedEventChannel::Subscribe(uint32_t eventId, Handler handler)
+{
+    _handlers[eventId] = std::move(handler);
+}
+
+void SharedEventChannel::Unsubscribe(uint32_t eventId)
+{
+    _handlers.erase(eventId);
+}
+
+size_t SharedEventChannel::Poll()
+{
+    size_t dispatched = 0;
+    uint32_t eventId = 0;
+    size_t size = 0;
+    bool fromSelf = false;
+
+    while (TryRead(eventId, size, fromSelf))
+    {
+        if (fromSelf) continue;
+
+        auto it = _handlers.find(eventId);
+        if (it == _handlers.end()) continue;
+
+        it->second(_scratch.data(), size);
+        ++dispatched;
+    }
+    return dispatched;
+}
+
+size_t SharedEventChannel::WaitAndPoll(std::chrono::microseconds timeout)
+{
+#ifdef __linux__
+    ChannelHeader* header = Header(_mapping);
+    const uint32_t observed = header->wakeSequence.load(std::memory_order_seq_cst);
+
+    if (!HasPending() && timeout.count() > 0)
+    {
+        header->sleepers.fetch_add(1, std::memory_order_seq_cst);
+        FutexWait(&header->wakeSequence, observed, timeout);
+        header->sleepers.fetch_sub(1, std::memory_order_seq_cst);
+    }
+#else
+    (void)timeout;
+#endif
+    return Poll();
+}
+
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+// Private Methods
+
+bool SharedEventChannel::TryRead(uint32_t& outEventId, size_t& outSize, bool& outFromSelf)
+{
+    ChannelHeader* header = Header(_mapping);
+
+    while (true)
+    {
+        const uint8_t* slotBytes = static_cast<const uint8_t*>(_mapping) + SLOTS_OFFSET + (_readTicket % _slotCount) * _slotStride;
+        SlotHeader* slot = reinterpret_cast<SlotHeader*>(const_cast<uint8_t*>(slotBytes));
+
+        const uint64_t expected = 2 * _readTicket + 2;
+        const uint64_t before = slot->seq.load(std::memory_order_acquire);
+        if (before < expected)
+        {
+            // Not yet published, or still being written. Wait for it while it is the newest ticket or
+            // its publisher may just be slow; once later tickets exist and it stays unfinished past
+            // the timeout, its publisher died or was descheduled, so skip it as an overrun.
+            if (header->head.load(std::memory_order_acquire) <= _readTicket + 1) return false;
+
+            const auto now = std::chrono::steady_clock::now();
+            if (!_stalled || _stallTicket != _readTicket)
+            {
+                _stalled = true;
+                _stallTicket = _readTicket;
+                _stallSince = now;
+                return false;
+            }
+            if (now - _stallSince < STUCK_WRITER_TIMEOUT) return false;
+
+            _stalled = false;
+            ++_overruns;
+            ++_readTicket;
+            continue;
+        }
+
+        if (before == expected)
+        {
+            const uint64_t senderId = slot->senderId;
+            const uint32_t eventId = slot->eventId;
+            const uint32_t size = slot->size;
+            if (size <= _slotPayload) std::memcpy(_scratch.data(), slotBytes + sizeof(SlotHeader), size);
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot->seq.load(std::memory_order_relaxed) == expected && size <= _slotPayload)
+            {
+                ++_readTicket;
+                outEventId = eventId;
+                outSize = size;
+                outFromSelf = senderId == _senderId;
+                return true;
+            }
+        }
+
+        // The slot was overwritten by a later lap: skip to the oldest message still in the ring.
+        const uint64_t head = header->head.load(std::memory_order_acquire);
+        const uint64_t oldest = head > _slotCount ? head - _slotCount : 0;
+        const uint64_t next = std::max(_readTicket + 1, oldest);
+        _overruns += next - _readTicket;
+        _readTicket = next;
+    }
+}
+
+bool SharedEventChannel::HasPending() const
+{
+    const uint8_t* slotBytes = static_cast<const uint8_t*>(_mapping) + SLOTS_OFFSET + (_readTicket % _slotCount) * _slotStride;
+    const SlotHeader* slot = reinterpret_cast<const SlotHeader*>(slotBytes);
+    return slot->seq.load(std::memory_order_acquire) >= 2 * _readTicket + 2;
+}
+
+} // namespace velecs::common
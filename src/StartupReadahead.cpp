@@ -0,0 +1,311 @@
+/// @file    StartupReadahead.cpp
+/// @author  Matthew Green
+/// @date    2026-10-18 17:31:05
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/common/StartupReadahead.hpp"
+#include "velecs/common/Paths.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace velecs::common {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr char PROFILE_HEADER[] = "# velecs readahead profile v1";
+
+/// @brief A range of an asset file, relative to Paths::AssetsDir()
+struct AccessRange {
+    std::string file;
+    uint64_t offset;
+    uint64_t length;
+};
+
+struct ReplayStats {
+    uint64_t files{0};
+    uint64_t bytes{0};
+    double milliseconds{0.0};
+};
+
+std::mutex g_mutex;
+bool g_started = false;
+StartupReadahead::Mode g_mode = StartupReadahead::Mode::Off;
+Clock::time_point g_startTime;
+
+std::atomic<bool> g_recording{false};
+std::vector<AccessRange> g_accesses;
+std::unordered_map<std::string, size_t> g_wholeFileIndex;
+
+std::atomic<bool> g_stopReplay{false};
+ReplayStats g_replayStats;
+
+/// @brief Owns the replay thread so a process exiting between BeginStartup() and EndStartup()
+/// stops and joins it instead of destroying a joinable std::thread
+/// @note Declared after everything the thread touches, so it is destroyed first
+struct ReplayThread {
+    std::thread thread;
+
+    ~ReplayThread()
+    {
+        if (!thread.joinable()) return;
+        g_stopReplay.store(true, std::memory_order_relaxed);
+        thread.join();
+    }
+};
+
+ReplayThread g_replay;
+
+const char* ModeName(StartupReadahead::Mode mode)
+{
+    switch (mode)
+    {
+        case StartupReadahead::Mode::Record: return "record";
+        case StartupReadahead::Mode::Replay: return "replay";
+        case StartupReadahead::Mode::RecordAndReplay: return "record+replay";
+        default: return "off";
+    }
+}
+
+std::vector<AccessRange> LoadProfile(const std::filesystem::path& path)
+{
+    std::vector<AccessRange> ranges;
+    std::ifstream in(path);
+    if (!in) return ranges;
+
+    std::string line;
+    if (!std::getline(in, line) || line != PROFILE_HEADER) return ranges;
+
+    while (std::getline(in, line))
+    {
+        std::istringstream fields(line);
+        AccessRange range;
+        if (!(fields >> range.offset >> range.length)) continue;
+        fields.get(); // Separator before the path, which may contain spaces
+        std::getline(fields, range.file);
+        if (!range.file.empty()) ranges.push_back(std::move(range));
+    }
+    return ranges;
+}
+
+void SaveProfile(const std::filesystem::path& path, const std::vector<AccessRange>& ranges)
+{
+    std::filesystem::path temporary = path;
+    temporary += ".tmp";
+    {
+        std::ofstream out(temporary, std::ios::trunc);
+        out << PROFILE_HEADER << '\n';
+        for (const AccessRange& range : ranges)
+        {
+            out << range.offset << ' ' << range.length << ' ' << range.file << '\n';
+        }
+        if (!out) return;
+    }
+    std::error_code error;
+    std::filesystem::rename(temporary, path, error);
+}
+
+/// @brief Pulls one range into the page cache; returns the bytes requested
+uint64_t Prefetch(const std::filesystem::path& file, uint64_t offset, uint64_t length)
+{
+#ifndef _WIN32
+    const int fd = ::open(file.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return 0;
+
+    if (length == 0)
+    {
+        const off_t end = ::lseek(fd, 0, SEEK_END);
+        length = end > static_cast<off_t>(offset) ? static_cast<uint64_t>(end) - offset : 0;
+    }
+#ifdef __linux__
+    // readahead() blocks until the range is in the page cache, so this thread stays ahead of the
+    // loaders only while the disk keeps up; EndStartup() may wait for the range in flight
+    ::readahead(fd, static_cast<off64_t>(offset), static_cast<size_t>(length));
+#else
+    ::posix_fadvise(fd, static_cast<off_t>(offset), static_cast<off_t>(length), POSIX_FADV_WILLNEED);
+#endif
+    ::close(fd);
+    return length;
+#else
+    // No asynchronous readahead for plain files on Windows; reading warms the file cache the same way
+    std::ifstream in(file, std::ios::binary);
+    if (!in) return 0;
+    in.seekg(static_cast<std::streamoff>(offset));
+
+    std::vector<char> buffer(256 * 1024);
+    uint64_t total = 0;
+    while (in && !g_stopReplay.load(std::memory_order_relaxed) && (length == 0 || total < length))
+    {
+        const uint64_t want = length == 0 ? buffer.size() : std::min<uint64_t>(buffer.size(), length - total);
+        in.read(buffer.data(), static_cast<std::streamsize>(want));
+        total += static_cast<uint64_t>(in.gcount());
+    }
+    return total;
+#endif
+}
+
+void ReplayProfile(std::vector<AccessRange> ranges, std::filesystem::path assetsDir)
+{
+    const Clock::time_point start = Clock::now();
+    ReplayStats stats;
+    std::string lastFile;
+
+    for (const AccessRange& range : ranges)
+    {
+        if (g_stopReplay.load(std::memory_order_relaxed)) break;
+
+        stats.bytes += Prefetch(assetsDir / std::filesystem::u8path(range.file), range.offset, range.length);
+        if (range.file != lastFile) ++stats.files;
+        lastFile = range.file;
+    }
+
+    stats.milliseconds = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    std::lock_guard<std::mutex> lock(g_mutex);
+    g_replayStats = stats;
+}
+
+} // namespace
+
+// Public Fields
+
+// Constructors and Destructors
+
+// Public Methods
+
+void StartupReadahead::BeginStartup(Mode mode)
+{
+    const std::filesystem::path profilePath = ProfilePath();
+    std::filesystem::create_directories(profilePath.parent_path());
+
+    std::lock_guard<std::mutex> lock(g_mutex);
+    if (g_started)
+        throw std::runtime_error("StartupReadahead::BeginStartup() called twice.");
+
+    g_started = true;
+    g_mode = mode;
+    g_startTime = Clock::now();
+    g_accesses.clear();
+    g_wholeFileIndex.clear();
+    g_replayStats = ReplayStats{};
+
+    if (mode == Mode::Replay || mode == Mode::RecordAndReplay)
+    {
+        std::vector<AccessRange> ranges = LoadProfile(profilePath);
+        if (!ranges.empty())
+        {
+            g_stopReplay.store(false, std::memory_order_relaxed);
+            g_replay.thread = std::thread(ReplayProfile, std::move(ranges), Paths::AssetsDir());
+        }
+    }
+
+    g_recording.store(mode == Mode::Record || mode == Mode::RecordAndReplay, std::memory_order_release);
+}
+
+void StartupReadahead::NoteAccess(const std::filesystem::path& file, uint64_t offset, uint64_t length)
+{
+    if (!g_recording.load(std::memory_order_relaxed)) return;
+
+    const std::filesystem::path relative = file.lexically_normal().lexically_relative(Paths::AssetsDir());
+    if (relative.empty() || *relative.begin() == "..") return;
+    // generic_u8string() returns std::u8string from C++20 on; copy the bytes so both standards build
+    const auto utf8 = relative.generic_u8string();
+    const std::string key(utf8.begin(), utf8.end());
+
+    std::lock_guard<std::mutex> lock(g_mutex);
+    if (!g_recording.load(std::memory_order_relaxed)) return;
+
+    // A whole-file read subsumes every later access to the same file
+    if (g_wholeFileIndex.count(key) != 0) return;
+    if (length == 0 && offset == 0) g_wholeFileIndex.emplace(key, g_accesses.size());
+
+    g_accesses.push_back({key, offset, length});
+}
+
+double StartupReadahead::EndStartup()
+{
+    std::thread replayThread;
+    std::vector<AccessRange> accesses;
+    Mode mode;
+    double milliseconds;
+    {
+        std::lock_guard<std::mutex> lock(g_mutex);
+        if (!g_started) return 0.0;
+
+        milliseconds = std::chrono::duration<double, std::milli>(Clock::now() - g_startTime).count();
+        mode = g_mode;
+        g_recording.store(false, std::memory_order_release);
+        accesses.swap(g_accesses);
+        g_wholeFileIndex.clear();
+        replayThread = std::move(g_replay.thread);
+        g_started = false;
+    }
+
+    // Anything still unprefetched is no longer ahead of the loaders
+    g_stopReplay.store(true, std::memory_order_relaxed);
+    if (replayThread.joinable()) replayThread.join();
+
+    if ((mode == Mode::Record || mode == Mode::RecordAndReplay) && !accesses.empty())
+        SaveProfile(ProfilePath(), accesses);
+
+    ReplayStats stats;
+    {
+        std::lock_guard<std::mutex> lock(g_mutex);
+        stats = g_replayStats;
+    }
+
+    const std::filesystem::path reportPath = ReportPath();
+    const bool newReport = !std::filesystem::exists(reportPath);
+    std::ofstream report(reportPath, std::ios::app);
+    if (newReport) report << "unix_ms,mode,startup_ms,recorded_ranges,replayed_files,replayed_bytes,replay_ms\n";
+
+    const auto now = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    report << now << ',' << ModeName(mode) << ',' << milliseconds << ',' << accesses.size() << ','
+           << stats.files << ',' << stats.bytes << ',' << stats.milliseconds << '\n';
+
+    return milliseconds;
+}
+
+bool StartupReadahead::IsRecording()
+{
+    return g_recording.load(std::memory_order_relaxed);
+}
+
+std::filesystem::path StartupReadahead::ProfilePath()
+{
+    return Paths::PersistentDataDir() / "Startup" / "readahead.profile";
+}
+
+std::filesystem::path StartupReadahead::ReportPath()
+{
+    return Paths::PersistentDataDir() / "Startup" / "startup-report.csv";
+}
+
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+// Private Methods
+
+} // namespace velecs::common
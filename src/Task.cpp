@@ -0,0 +1,232 @@
+/// @file    Task.cpp
+/// @author  Matthew Green
+/// @date    2026-10-18 21:15:03
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/common/Task.hpp"
+
+#if VELECS_HAS_COROUTINES
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+
+namespace velecs::common {
+
+namespace {
+
+constexpr size_t CLASS_COUNT = FramePool::MAX_POOLED_SIZE / FramePool::CLASS_SIZE;
+
+struct ThreadCache;
+
+/// @brief Prefix of every pooled frame, recording the cache it returns to
+struct alignas(alignof(std::max_align_t)) FrameHeader {
+    ThreadCache* owner;
+    FrameHeader* next;
+    size_t sizeClass;
+};
+
+/// @brief Bytes of a pooled block, header included
+constexpr size_t BlockSize(size_t sizeClass)
+{
+    return sizeof(FrameHeader) + (sizeClass + 1) * FramePool::CLASS_SIZE;
+}
+
+/// @brief Free frames of one thread, plus the frames other threads have freed back to it
+/// @details Caches are never deleted, so a frame freed after its owning thread exited can still be
+///          pushed onto the owner's remote list; the next thread to adopt the cache reuses it.
+struct ThreadCache {
+    /// @brief Owner-only free lists, one per size class
+    FrameHeader* heads[CLASS_COUNT] = {};
+
+    /// @brief Bytes held in heads, kept under MAX_CACHED_BYTES
+    size_t cachedBytes{0};
+
+    /// @brief Frames freed by other threads; pushed with a CAS, taken whole by the owner
+    std::atomic<FrameHeader*> remoteFrees{nullptr};
+
+    /// @brief Set while a thread owns the cache
+    std::atomic<bool> inUse{false};
+
+    /// @brief Next cache in the process-wide list
+    ThreadCache* nextCache{nullptr};
+
+    /// @brief Caches a frame for reuse, or returns it to the heap if the cache is full
+    /// @note Owner thread only
+    void Push(FrameHeader* header)
+    {
+        const size_t bytes = BlockSize(header->sizeClass);
+        if (cachedBytes + bytes > FramePool::MAX_CACHED_BYTES)
+        {
+            ::operator delete(header);
+            return;
+        }
+
+        header->next = heads[header->sizeClass];
+        heads[header->sizeClass] = header;
+        cachedBytes += bytes;
+    }
+
+    /// @brief Moves the frames other threads returned into the owner's free lists
+    /// @note Owner thread only
+    void DrainRemoteFrees()
+    {
+        FrameHeader* header = remoteFrees.exchange(nullptr, std::memory_order_acquire);
+        while (header != nullptr)
+        {
+            FrameHeader* next = header->next;
+            Push(header);
+            header = next;
+        }
+    }
+
+    /// @brief Returns every cached frame to the heap and gives up ownership
+    /// @note Called by the owner thread as it exits
+    void Release()
+    {
+        DrainRemoteFrees();
+        for (FrameHeader*& head : heads)
+        {
+            while (head != nullptr)
+            {
+                FrameHeader* header = head;
+                head = header->next;
+                ::operator delete(header);
+            }
+        }
+        cachedBytes = 0;
+        inUse.store(false, std::memory_order_release);
+    }
+};
+
+/// @brief Every cache ever created; push-only, so traversal needs no lock
+std::atomic<ThreadCache*> g_caches{nullptr};
+
+/// @brief The calling thread's cache; trivially initialized so it stays readable during thread exit
+thread_local ThreadCache* t_cache = nullptr;
+
+/// @brief Set once the calling thread has released its cache
+thread_local bool t_cacheReleased = false;
+
+/// @brief Releases the calling thread's cache when the thread exits
+struct CacheHolder {
+    ~CacheHolder()
+    {
+        if (t_cache != nullptr) t_cache->Release();
+        t_cache = nullptr;
+        t_cacheReleased = true;
+    }
+};
+
+/// @brief Takes over a cache released by an exited thread, or creates a new one
+ThreadCache* AdoptCache()
+{
+    thread_local CacheHolder holder;
+
+    for (ThreadCache* cache = g_caches.load(std::memory_order_acquire); cache != nullptr; cache = cache->nextCache)
+    {
+        bool expected = false;
+        if (cache->inUse.compare_exchange_strong(expected, true, std::memory_order_acquire)) return cache;
+    }
+
+    ThreadCache* cache = new ThreadCache();
+    cache->inUse.store(true, std::memory_order_relaxed);
+    cache->nextCache = g_caches.load(std::memory_order_relaxed);
+    while (!g_caches.compare_exchange_weak(cache->nextCache, cache, std::memory_order_release, std::memory_order_relaxed)) {}
+    return cache;
+}
+
+/// @brief Gets the calling thread's cache
+/// @return The cache, or nullptr once the thread has released it during exit
+ThreadCache* LocalCache()
+{
+    if (t_cache == nullptr && !t_cacheReleased) t_cache = AdoptCache();
+    return t_cache;
+}
+
+size_t ClassOf(size_t size)
+{
+    return (size + FramePool::CLASS_SIZE - 1) / FramePool::CLASS_SIZE - 1;
+}
+
+} // namespace
+
+// Public Fields
+
+// Constructors and Destructors
+
+// Public Methods
+
+void* FramePool::Allocate(size_t size)
+{
+    if (size == 0 || size > MAX_POOLED_SIZE) return ::operator new(size);
+
+    const size_t sizeClass = ClassOf(size);
+    ThreadCache* cache = LocalCache();
+    if (cache != nullptr)
+    {
+        if (cache->heads[sizeClass] == nullptr && cache->remoteFrees.load(std::memory_order_relaxed) != nullptr)
+        {
+            cache->DrainRemoteFrees();
+        }
+        if (FrameHeader* header = cache->heads[sizeClass])
+        {
+            cache->heads[sizeClass] = header->next;
+            cache->cachedBytes -= BlockSize(sizeClass);
+            return header + 1;
+        }
+    }
+
+    // Allocate the full class size so the block can serve any frame of its class later
+    auto* header = static_cast<FrameHeader*>(::operator new(BlockSize(sizeClass)));
+    header->owner = cache;
+    header->next = nullptr;
+    header->sizeClass = sizeClass;
+    return header + 1;
+}
+
+void FramePool::Free(void* memory, size_t size) noexcept
+{
+    if (memory == nullptr) return;
+    if (size == 0 || size > MAX_POOLED_SIZE)
+    {
+        ::operator delete(memory);
+        return;
+    }
+
+    FrameHeader* header = static_cast<FrameHeader*>(memory) - 1;
+    ThreadCache* owner = header->owner;
+    if (owner == nullptr)
+    {
+        ::operator delete(header);
+    }
+    else if (owner == t_cache)
+    {
+        owner->Push(header);
+    }
+    else
+    {
+        // Hand the frame back to the thread that allocated it, so a task started on one thread and
+        // finished on another does not drain the first thread's cache into the second's
+        header->next = owner->remoteFrees.load(std::memory_order_relaxed);
+        while (!owner->remoteFrees.compare_exchange_weak(header->next, header,
+            std::memory_order_release, std::memory_order_relaxed)) {}
+    }
+}
+
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+// Private Methods
+
+} // namespace velecs::common
+
+#endif // VELECS_HAS_COROUTINES
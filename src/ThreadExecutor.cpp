@@ -0,0 +1,114 @@
+/// @file    ThreadExecutor.cpp
+/// @author  Matthew Green
+/// @date    2026-10-18 13:21:52
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/common/ThreadExecutor.hpp"
+
+namespace velecs::common {
+
+namespace {
+
+/// @brief Task wrapping a type-erased function
+class FunctionTask final : public ThreadExecutor::Task {
+public:
+    explicit FunctionTask(std::function<void()> function) : _function(std::move(function)) {}
+
+    void Run() override { _function(); }
+
+private:
+    std::function<void()> _function;
+};
+
+} // namespace
+
+// Public Fields
+
+// Constructors and Destructors
+
+ThreadExecutor::ThreadExecutor()
+    : _owner(std::this_thread::get_id())
+{
+}
+
+ThreadExecutor::~ThreadExecutor()
+{
+    DeleteList(_pending);
+    DeleteList(_head.exchange(nullptr, std::memory_order_acquire));
+}
+
+// Public Methods
+
+void ThreadExecutor::Post(std::unique_ptr<Task> task)
+{
+    Task* node = task.release();
+    node->_next = _head.load(std::memory_order_relaxed);
+    while (!_head.compare_exchange_weak(node->_next, node, std::memory_order_release, std::memory_order_relaxed))
+    {
+    }
+}
+
+void ThreadExecutor::Post(std::function<void()> function)
+{
+    Post(std::make_unique<FunctionTask>(std::move(function)));
+}
+
+size_t ThreadExecutor::Drain()
+{
+    // Take the whole inbox at once and reverse it into posting order behind any leftovers.
+    Task* taken = _head.exchange(nullptr, std::memory_order_acquire);
+    Task* ordered = nullptr;
+    while (taken != nullptr)
+    {
+        Task* next = taken->_next;
+        taken->_next = ordered;
+        ordered = taken;
+        taken = next;
+    }
+
+    if (_pending == nullptr)
+    {
+        _pending = ordered;
+    }
+    else
+    {
+        Task* tail = _pending;
+        while (tail->_next != nullptr) tail = tail->_next;
+        tail->_next = ordered;
+    }
+
+    size_t count = 0;
+    while (_pending != nullptr)
+    {
+        std::unique_ptr<Task> task(_pending);
+        _pending = task->_next;
+        task->Run();
+        ++count;
+    }
+    return count;
+}
+
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+// Private Methods
+
+void ThreadExecutor::DeleteList(Task* list)
+{
+    while (list != nullptr)
+    {
+        Task* next = list->_next;
+        delete list;
+        list = next;
+    }
+}
+
+} // namespace velecs::common
@@ -0,0 +1,487 @@
+/// @file    TieredCache.cpp
+/// @author  Matthew Green
+/// @date    2026-10-18 18:02:44
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/common/TieredCache.hpp"
+
+#include <atomic>
+#include <cctype>
+#include <fstream>
+#include <functional>
+#include <stdexcept>
+
+namespace velecs::common {
+
+namespace {
+
+/// @brief Prefix of in-progress files; never produced by FileNameFor
+constexpr char TEMP_PREFIX = '~';
+
+bool ReadWholeFile(const std::filesystem::path& path, std::vector<uint8_t>& out)
+{
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) return false;
+
+    std::streamsize size = file.tellg();
+    if (size < 0) return false;
+    out.resize(static_cast<size_t>(size));
+    file.seekg(0);
+    return size == 0 || static_cast<bool>(file.read(reinterpret_cast<char*>(out.data()), size));
+}
+
+/// @brief Gets a temp path next to a target, unique per call so concurrent writers never share one
+std::filesystem::path TempPathFor(const std::filesystem::path& path)
+{
+    static std::atomic<uint64_t> counter{0};
+    return path.parent_path() /
+        (TEMP_PREFIX + std::to_string(counter.fetch_add(1, std::memory_order_relaxed)) + TEMP_PREFIX + path.filename().string());
+}
+
+bool WriteFile(const std::filesystem::path& path, const void* data, size_t size)
+{
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) return false;
+    file.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+    return static_cast<bool>(file);
+}
+
+/// @brief Renames a finished temp file over its target, removing the temp file on failure
+bool CommitTempFile(const std::filesystem::path& temp, const std::filesystem::path& path)
+{
+    std::error_code error;
+    std::filesystem::rename(temp, path, error);
+    if (error)
+    {
+        std::filesystem::remove(temp, error);
+        return false;
+    }
+    return true;
+}
+
+/// @brief Writes to a temp file and renames it over the target so readers never see a partial file
+bool WriteFileAtomically(const std::filesystem::path& path, const void* data, size_t size)
+{
+    std::filesystem::path temp = TempPathFor(path);
+    if (!WriteFile(temp, data, size))
+    {
+        std::error_code error;
+        std::filesystem::remove(temp, error);
+        return false;
+    }
+    return CommitTempFile(temp, path);
+}
+
+int HexValue(char c)
+{
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+
+} // namespace
+
+// Public Fields
+
+// Constructors and Destructors
+
+TieredCache::TieredCache(const std::string& name)
+    : TieredCache(name, Options{}) {}
+
+TieredCache::TieredCache(const std::string& name, const Options& options)
+    : _options(options)
+{
+    const std::filesystem::path& fastRoot = Paths::CacheDir(Paths::CacheTier::Fast);
+    const std::filesystem::path& durableRoot = Paths::CacheDir(Paths::CacheTier::Durable);
+
+    _hasFastTier = fastRoot != durableRoot;
+    _fastDir = fastRoot / name;
+    _durableDir = durableRoot / name;
+    std::filesystem::create_directories(_durableDir);
+
+    if (_hasFastTier)
+    {
+        std::filesystem::create_directories(_fastDir);
+
+        // Entries left in RAM by an earlier run that exited before writing them back
+        for (const auto& file : std::filesystem::directory_iterator(_fastDir))
+        {
+            if (!file.is_regular_file()) continue;
+
+            std::string fileName = file.path().filename().string();
+            if (fileName.empty() || fileName[0] == TEMP_PREFIX)
+            {
+                std::error_code error;
+                std::filesystem::remove(file.path(), error);
+                continue;
+            }
+
+            // Not one of ours (or from an incompatible encoding): leave it alone
+            std::optional<std::string> key = KeyForFileName(fileName);
+            if (!key) continue;
+
+            Entry& entry = _entries[*key];
+            entry.inFast = true;
+            entry.size = file.file_size();
+            _lru.push_back(*key);
+            entry.lruPosition = std::prev(_lru.end());
+            _fastBytes += entry.size;
+
+            std::error_code error;
+            std::filesystem::path durable = _durableDir / fileName;
+            if (!std::filesystem::exists(durable, error) ||
+                std::filesystem::last_write_time(durable, error) < file.last_write_time())
+            {
+                entry.dirty = true;
+                entry.dirtySince = std::chrono::steady_clock::now();
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        EnforceFastCapacity(true);
+
+        _writeBackThread = std::thread([this] { WriteBackLoop(); });
+    }
+}
+
+TieredCache::~TieredCache()
+{
+    if (_writeBackThread.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stopWriteBack = true;
+        }
+        _writeBackCv.notify_one();
+        _writeBackThread.join();
+    }
+    Flush();
+}
+
+// Public Methods
+
+void TieredCache::Put(const std::string& key, const void* data, size_t size)
+{
+    std::string fileName = FileNameFor(key);
+
+    if (_hasFastTier && size <= _options.fastCapacityBytes)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        ++MutationGeneration(key);
+        if (StoreInFastTier(key, _entries[key], data, size, true)) return;
+        // RAM tier full or gone: keep the entry durable-only
+    }
+
+    PutDurable(key, fileName, data, size);
+}
+
+bool TieredCache::TryGet(const std::string& key, std::vector<uint8_t>& outValue)
+{
+    std::string fileName = FileNameFor(key);
+
+    bool inFast = false;
+    uint64_t generation = 0;
+    if (_hasFastTier)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        generation = MutationGeneration(key);
+        auto it = _entries.find(key);
+        if (it != _entries.end() && it->second.inFast)
+        {
+            inFast = true;
+            _lru.splice(_lru.begin(), _lru, it->second.lruPosition);
+        }
+    }
+
+    // File reads happen outside the lock; writers replace files by rename, and a fast copy is only
+    // deleted after it has been written back, so a failed fast read can always fall back to durable
+    if (inFast && ReadWholeFile(_fastDir / fileName, outValue)) return true;
+    if (!ReadWholeFile(_durableDir / fileName, outValue)) return false;
+    if (!_hasFastTier) return true;
+
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    // A Put or Remove since the first lock may have replaced or deleted what was read; the read still
+    // stands, but promoting it would resurrect the old value in the fast tier
+    if (MutationGeneration(key) != generation) return true;
+
+    Entry& entry = _entries[key];
+    if (!entry.inFast && ++entry.reads >= _options.promoteAfterReads && outValue.size() <= _options.fastCapacityBytes)
+    {
+        StoreInFastTier(key, entry, outValue.data(), outValue.size(), false);
+    }
+    return true;
+}
+
+std::optional<std::vector<uint8_t>> TieredCache::Get(const std::string& key)
+{
+    std::vector<uint8_t> value;
+    if (!TryGet(key, value)) return std::nullopt;
+    return value;
+}
+
+void TieredCache::Remove(const std::string& key)
+{
+    std::string fileName = FileNameFor(key);
+    std::lock_guard<std::mutex> lock(_mutex);
+    ++MutationGeneration(key);
+
+    auto it = _entries.find(key);
+    if (it != _entries.end())
+    {
+        if (it->second.inFast)
+        {
+            _fastBytes -= it->second.size;
+            _lru.erase(it->second.lruPosition);
+        }
+        _entries.erase(it);
+    }
+
+    std::error_code error;
+    if (_hasFastTier) std::filesystem::remove(_fastDir / fileName, error);
+    std::filesystem::remove(_durableDir / fileName, error);
+}
+
+void TieredCache::Flush()
+{
+    WriteBackDirty(std::chrono::steady_clock::time_point::max());
+}
+
+bool TieredCache::IsInFastTier(const std::string& key) const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto it = _entries.find(key);
+    return it != _entries.end() && it->second.inFast;
+}
+
+uint64_t TieredCache::FastTierBytes() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _fastBytes;
+}
+
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+// Private Methods
+
+std::string TieredCache::FileNameFor(const std::string& key)
+{
+    static const char* hex = "0123456789ABCDEF";
+
+    std::string fileName;
+    fileName.reserve(key.size());
+    for (size_t i = 0; i < key.size(); ++i)
+    {
+        unsigned char c = static_cast<unsigned char>(key[i]);
+        bool plain = std::isalnum(c) || c == '-' || c == '_' || (c == '.' && i != 0);
+        if (plain)
+        {
+            fileName.push_back(static_cast<char>(c));
+        }
+        else
+        {
+            fileName.push_back('%');
+            fileName.push_back(hex[c >> 4]);
+            fileName.push_back(hex[c & 0xF]);
+        }
+    }
+    return fileName.empty() ? std::string("%") : fileName;
+}
+
+std::optional<std::string> TieredCache::KeyForFileName(const std::string& fileName)
+{
+    if (fileName == "%") return std::string();
+
+    std::string key;
+    key.reserve(fileName.size());
+    for (size_t i = 0; i < fileName.size(); ++i)
+    {
+        if (fileName[i] != '%')
+        {
+            key.push_back(fileName[i]);
+            continue;
+        }
+
+        int high = i + 2 < fileName.size() ? HexValue(fileName[i + 1]) : -1;
+        int low = high >= 0 ? HexValue(fileName[i + 2]) : -1;
+        if (low < 0) return std::nullopt;
+        key.push_back(static_cast<char>((high << 4) | low));
+        i += 2;
+    }
+
+    // Reject names FileNameFor would have spelled differently, so every recovered key maps back to its file
+    if (FileNameFor(key) != fileName) return std::nullopt;
+    return key;
+}
+
+uint64_t& TieredCache::MutationGeneration(const std::string& key)
+{
+    return _mutationGenerations[std::hash<std::string>{}(key) % _mutationGenerations.size()];
+}
+
+bool TieredCache::StoreInFastTier(const std::string& key, Entry& entry, const void* data, size_t size, bool dirty)
+{
+    if (!WriteFileAtomically(_fastDir / FileNameFor(key), data, size)) return false;
+
+    if (entry.inFast)
+    {
+        _fastBytes -= entry.size;
+        _lru.splice(_lru.begin(), _lru, entry.lruPosition);
+    }
+    else
+    {
+        _lru.push_front(key);
+        entry.lruPosition = _lru.begin();
+        entry.inFast = true;
+    }
+    entry.size = size;
+    entry.reads = 0;
+    ++entry.version;
+    _fastBytes += size;
+
+    if (dirty && !entry.dirty)
+    {
+        entry.dirty = true;
+        entry.dirtySince = std::chrono::steady_clock::now();
+    }
+
+    EnforceFastCapacity(true);
+    return true;
+}
+
+void TieredCache::PutDurable(const std::string& key, const std::string& fileName, const void* data, size_t size)
+{
+    // The file is written without _mutex so readers are not blocked by the I/O. Holding _writeBackMutex
+    // instead keeps a write-back pass from renaming an older fast copy over it before that copy is dropped.
+    std::lock_guard<std::mutex> writeBackLock(_writeBackMutex);
+    if (!WriteFileAtomically(_durableDir / fileName, data, size))
+        throw std::runtime_error("TieredCache: failed to write entry '" + key + "'");
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    ++MutationGeneration(key);
+
+    auto it = _entries.find(key);
+    if (it != _entries.end())
+    {
+        if (it->second.inFast)
+        {
+            std::error_code error;
+            std::filesystem::remove(_fastDir / fileName, error);
+            _fastBytes -= it->second.size;
+            _lru.erase(it->second.lruPosition);
+        }
+        _entries.erase(it);
+    }
+}
+
+void TieredCache::EnforceFastCapacity(bool requestWriteBack)
+{
+    bool skippedDirty = false;
+    auto it = _lru.end();
+    while (_fastBytes > _options.fastCapacityBytes && it != _lru.begin())
+    {
+        --it;
+        auto entryIt = _entries.find(*it);
+        Entry& entry = entryIt->second;
+
+        // Never drop the only copy of an entry; the write-back thread writes it and evicts again
+        if (entry.dirty)
+        {
+            skippedDirty = true;
+            continue;
+        }
+
+        std::error_code error;
+        std::filesystem::remove(_fastDir / FileNameFor(*it), error);
+        _fastBytes -= entry.size;
+        it = _lru.erase(it);
+        _entries.erase(entryIt);
+    }
+
+    if (skippedDirty && requestWriteBack && _fastBytes > _options.fastCapacityBytes)
+    {
+        _evictionPending = true;
+        _writeBackCv.notify_one();
+    }
+}
+
+void TieredCache::WriteBackDirty(std::chrono::steady_clock::time_point cutoff)
+{
+    std::lock_guard<std::mutex> writeBackLock(_writeBackMutex);
+
+    struct Job {
+        std::string key;
+        uint64_t version;
+    };
+    std::vector<Job> jobs;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        for (const auto& [key, entry] : _entries)
+        {
+            if (entry.dirty && entry.dirtySince <= cutoff) jobs.push_back({key, entry.version});
+        }
+    }
+
+    std::vector<uint8_t> bytes;
+    for (const Job& job : jobs)
+    {
+        // Copy to a temp file without the lock; a concurrent Put or eviction only makes this copy stale
+        const std::string fileName = FileNameFor(job.key);
+        const std::filesystem::path durable = _durableDir / fileName;
+        const std::filesystem::path temp = TempPathFor(durable);
+        if (!ReadWholeFile(_fastDir / fileName, bytes) || !WriteFile(temp, bytes.data(), bytes.size()))
+        {
+            std::error_code error;
+            std::filesystem::remove(temp, error);
+            continue;
+        }
+
+        // Publish only if the fast copy is still the one that was read
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto it = _entries.find(job.key);
+        if (it != _entries.end() && it->second.inFast && it->second.version == job.version)
+        {
+            if (CommitTempFile(temp, durable)) it->second.dirty = false;
+        }
+        else
+        {
+            std::error_code error;
+            std::filesystem::remove(temp, error);
+        }
+    }
+}
+
+void TieredCache::WriteBackLoop()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (!_stopWriteBack)
+    {
+        _writeBackCv.wait_for(lock, _options.writeBackDelay, [this] { return _stopWriteBack || _evictionPending; });
+        if (_stopWriteBack) break;
+
+        // Eviction is waiting on dirty entries: write all of them now rather than when they come due
+        const bool evicting = _evictionPending;
+        _evictionPending = false;
+        const auto cutoff = evicting ? std::chrono::steady_clock::time_point::max()
+                                     : std::chrono::steady_clock::now() - _options.writeBackDelay;
+
+        lock.unlock();
+        WriteBackDirty(cutoff);
+        lock.lock();
+
+        // Entries that still fail to write back stay in RAM until a later pass succeeds
+        EnforceFastCapacity(false);
+    }
+}
+
+} // namespace velecs::common
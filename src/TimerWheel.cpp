@@ -0,0 +1,375 @@
+/// @file    TimerWheel.cpp
+/// @author  Matthew Green
+/// @date    2026-10-18 11:58:06
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/common/TimerWheel.hpp"
+
+#include <stdexcept>
+
+namespace velecs::common {
+
+static_assert(sizeof(TimerWheel::Handle) >= sizeof(uint64_t), "Timer handles pack a generation and an index into 64 bits.");
+
+// Public Fields
+
+// Constructors and Destructors
+
+TimerWheel::TimerWheel(Duration tickDuration)
+    : _tickDuration(tickDuration)
+{
+    if (tickDuration.count() <= 0)
+        throw std::invalid_argument("TimerWheel tick duration must be positive.");
+
+    _slots.fill(NIL);
+    _slotTails.fill(NIL);
+}
+
+// Public Methods
+
+TimerWheel::Handle TimerWheel::Schedule(Duration delay, Callback callback)
+{
+    return Insert(ToTicks(delay), 0, std::move(callback));
+}
+
+TimerWheel::Handle TimerWheel::SchedulePeriodic(Duration interval, Callback callback)
+{
+    const uint64_t periodTicks = std::max<uint64_t>(ToTicks(interval), 1);
+    return Insert(periodTicks, periodTicks, std::move(callback));
+}
+
+bool TimerWheel::Cancel(Handle handle)
+{
+    uint32_t index;
+    if (!Resolve(handle, index)) return false;
+
+    Node& node = _nodes[index];
+    switch (node.state)
+    {
+    case NodeState::Scheduled:
+        Unlink(index);
+        Release(index);
+        --_scheduledCount;
+        return true;
+    case NodeState::Firing:
+        // Released by ProcessTick() once the callback returns
+        node.state = NodeState::Cancelled;
+        --_scheduledCount;
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool TimerWheel::IsScheduled(Handle handle) const
+{
+    uint32_t index;
+    if (!Resolve(handle, index)) return false;
+
+    const NodeState state = _nodes[index].state;
+    return state == NodeState::Scheduled || state == NodeState::Firing;
+}
+
+size_t TimerWheel::Advance(Duration elapsed)
+{
+    if (_advancing)
+        throw std::logic_error("TimerWheel::Advance() called from inside a timer callback.");
+
+    _carry += elapsed;
+    if (_carry < _tickDuration) return 0;
+
+    uint64_t ticks = static_cast<uint64_t>(_carry / _tickDuration);
+    _carry %= _tickDuration;
+
+    _advancing = true;
+    size_t fired = 0;
+    try
+    {
+        while (ticks > 0)
+        {
+            if (_scheduledCount == 0)
+            {
+                // Nothing can fire, so skip straight to the target tick
+                _currentTick += ticks;
+                break;
+            }
+            ++_currentTick;
+            fired += ProcessTick();
+            --ticks;
+        }
+    }
+    catch (...)
+    {
+        _advancing = false;
+        throw;
+    }
+    _advancing = false;
+
+    return fired;
+}
+
+void TimerWheel::Clear()
+{
+    for (uint32_t index = 0; index < _nodes.size(); ++index)
+    {
+        Node& node = _nodes[index];
+        if (node.state == NodeState::Scheduled)
+        {
+            Unlink(index);
+            Release(index);
+        }
+        else if (node.state == NodeState::Firing)
+        {
+            // The running tick releases these once the current callback returns
+            node.state = NodeState::Cancelled;
+        }
+        else if (node.state == NodeState::Cancelled && !_advancing)
+        {
+            Release(index);
+        }
+    }
+    _scheduledCount = 0;
+}
+
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+// Private Methods
+
+TimerWheel::Handle TimerWheel::Insert(uint64_t delayTicks, uint64_t periodTicks, Callback callback)
+{
+    uint32_t index;
+    if (!_freeNodes.empty())
+    {
+        index = _freeNodes.back();
+        _freeNodes.pop_back();
+    }
+    else
+    {
+        if (_nodes.size() >= NIL)
+            throw std::length_error("TimerWheel cannot hold more timers.");
+
+        index = static_cast<uint32_t>(_nodes.size());
+        _nodes.emplace_back();
+    }
+
+    // A timer never fires during the tick it was scheduled in
+    Node& node = _nodes[index];
+    node.expiry = _currentTick + std::max<uint64_t>(delayTicks, 1);
+    node.periodTicks = periodTicks;
+    node.state = NodeState::Scheduled;
+    node.callback = std::move(callback);
+
+    Link(index);
+    ++_scheduledCount;
+
+    return static_cast<Handle>((static_cast<uint64_t>(node.generation) << 32) | index);
+}
+
+uint64_t TimerWheel::ToTicks(Duration duration) const
+{
+    if (duration.count() <= 0) return 0;
+    return static_cast<uint64_t>((duration + _tickDuration - Duration(1)) / _tickDuration);
+}
+
+void TimerWheel::Link(uint32_t index)
+{
+    Node& node = _nodes[index];
+
+    // Overdue timers go in the slot of the tick being processed
+    const uint64_t expiry = std::max(node.expiry, _currentTick);
+    const uint64_t delta = expiry - _currentTick;
+
+    uint32_t slot;
+    if (delta < (uint64_t{1} << SLOT_BITS))
+    {
+        slot = static_cast<uint32_t>(expiry & SLOT_MASK);
+    }
+    else if (delta < (uint64_t{1} << (2 * SLOT_BITS)))
+    {
+        slot = SLOT_COUNT + static_cast<uint32_t>((expiry >> SLOT_BITS) & SLOT_MASK);
+    }
+    else if (delta < (uint64_t{1} << (3 * SLOT_BITS)))
+    {
+        slot = 2 * SLOT_COUNT + static_cast<uint32_t>((expiry >> (2 * SLOT_BITS)) & SLOT_MASK);
+    }
+    else
+    {
+        // Beyond the wheel's range: park at the farthest outer slot and re-place on cascade
+        const uint64_t parked = _currentTick + std::min(delta, MAX_TICK_DELTA);
+        slot = 3 * SLOT_COUNT + static_cast<uint32_t>((parked >> (3 * SLOT_BITS)) & SLOT_MASK);
+    }
+
+    node.slot = slot;
+    node.prev = _slotTails[slot];
+    node.next = NIL;
+    if (node.prev != NIL) _nodes[node.prev].next = index;
+    else _slots[slot] = index;
+    _slotTails[slot] = index;
+}
+
+void TimerWheel::Unlink(uint32_t index)
+{
+    Node& node = _nodes[index];
+
+    if (node.prev != NIL) _nodes[node.prev].next = node.next;
+    else _slots[node.slot] = node.next;
+
+    if (node.next != NIL) _nodes[node.next].prev = node.prev;
+    else _slotTails[node.slot] = node.prev;
+
+    node.prev = NIL;
+    node.next = NIL;
+    node.slot = NIL;
+}
+
+void TimerWheel::Release(uint32_t index)
+{
+    Node& node = _nodes[index];
+    node.state = NodeState::Free;
+    node.callback = nullptr;
+    ++node.generation;
+    if (node.generation == 0) node.generation = 1; // Keep handles non-zero
+    _freeNodes.push_back(index);
+}
+
+uint32_t TimerWheel::Cascade(uint32_t level)
+{
+    const uint32_t slotIndex = static_cast<uint32_t>((_currentTick >> (level * SLOT_BITS)) & SLOT_MASK);
+    const uint32_t slot = level * SLOT_COUNT + slotIndex;
+
+    uint32_t index = _slots[slot];
+    _slots[slot] = NIL;
+    _slotTails[slot] = NIL;
+    while (index != NIL)
+    {
+        const uint32_t next = _nodes[index].next;
+        Link(index);
+        index = next;
+    }
+
+    return slotIndex;
+}
+
+size_t TimerWheel::ProcessTick()
+{
+    // _currentTick is the tick being processed; it was advanced by the caller
+    const uint32_t slot = static_cast<uint32_t>(_currentTick & SLOT_MASK);
+
+    // Each time an inner level wraps, pull the next outer slot's timers inward
+    if (slot == 0)
+    {
+        for (uint32_t level = 1; level < LEVEL_COUNT; ++level)
+        {
+            if (Cascade(level) != 0) break;
+        }
+    }
+
+    // Detach the slot first so callbacks may freely schedule and cancel timers
+    _expired.clear();
+    for (uint32_t index = _slots[slot]; index != NIL; index = _nodes[index].next)
+    {
+        _expired.push_back(index);
+    }
+    _slots[slot] = NIL;
+    _slotTails[slot] = NIL;
+
+    size_t fired = 0;
+    for (size_t i = 0; i < _expired.size(); ++i)
+    {
+        const uint32_t index = _expired[i];
+        Node& node = _nodes[index];
+        node.prev = NIL;
+        node.next = NIL;
+        node.slot = NIL;
+
+        // Parked far-future timers land here early only if they were cascaded past their expiry
+        if (node.expiry > _currentTick)
+        {
+            Link(index);
+            continue;
+        }
+        node.state = NodeState::Firing;
+    }
+
+    for (size_t i = 0; i < _expired.size(); ++i)
+    {
+        const uint32_t index = _expired[i];
+        if (_nodes[index].state == NodeState::Cancelled)
+        {
+            // Cancelled by an earlier callback in this tick
+            Release(index);
+            continue;
+        }
+        if (_nodes[index].state != NodeState::Firing) continue;
+
+        // Callbacks may grow _nodes, so never hold a reference across the call
+        try
+        {
+            _nodes[index].callback();
+        }
+        catch (...)
+        {
+            // Drop the throwing timer and defer the rest of this tick's timers to the next tick
+            if (_nodes[index].state == NodeState::Firing) --_scheduledCount;
+            Release(index);
+
+            for (size_t j = i + 1; j < _expired.size(); ++j)
+            {
+                const uint32_t pending = _expired[j];
+                if (_nodes[pending].state == NodeState::Firing)
+                {
+                    _nodes[pending].state = NodeState::Scheduled;
+                    _nodes[pending].expiry = _currentTick + 1;
+                    Link(pending);
+                }
+                else if (_nodes[pending].state == NodeState::Cancelled)
+                {
+                    Release(pending);
+                }
+            }
+            throw;
+        }
+        ++fired;
+
+        Node& node = _nodes[index];
+        if (node.state == NodeState::Firing && node.periodTicks != 0)
+        {
+            node.expiry += node.periodTicks;
+            node.state = NodeState::Scheduled;
+            Link(index);
+        }
+        else
+        {
+            if (node.state == NodeState::Firing) --_scheduledCount;
+            Release(index);
+        }
+    }
+
+    return fired;
+}
+
+bool TimerWheel::Resolve(Handle handle, uint32_t& outIndex) const
+{
+    const auto raw = static_cast<uint64_t>(handle);
+    const auto index = static_cast<uint32_t>(raw & 0xFFFFFFFFu);
+    const auto generation = static_cast<uint32_t>(raw >> 32);
+
+    if (index >= _nodes.size() || _nodes[index].generation != generation || _nodes[index].state == NodeState::Free)
+    {
+        return false;
+    }
+
+    outIndex = index;
+    return true;
+}
+
+} // namespace velecs::common
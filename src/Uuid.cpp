@@ -9,12 +9,144 @@
 /// Proprietary and confidential
 
 #include "velecs/common/Uuid.hpp"
+#include "velecs/common/UuidString.hpp"
+#include "velecs/common/EntropyPool.hpp"
+#include "velecs/common/Metrics.hpp"
+
+#include <uuid.h> // `#include <stduuid/include/uuid.h>` does not work unfortunately.
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <optional>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
 
 namespace velecs::common {
 
+namespace {
+
+/// @brief Per-thread random UUID generator. The engine lives alongside the generator because
+/// uuids::uuid_random_generator keeps a pointer to the engine it was constructed with.
+struct RandomGenerator {
+    uint64_t generation{EntropyPool::Generation()};
+    std::mt19937 engine;
+    uuids::uuid_random_generator generator;
+
+    RandomGenerator() : engine(SeededEngine()), generator(engine) {}
+
+    RandomGenerator(const RandomGenerator&) = delete;
+    RandomGenerator& operator=(const RandomGenerator&) = delete;
+
+    static std::mt19937 SeededEngine()
+    {
+        std::array<uint32_t, std::mt19937::state_size> seedData;
+        static_assert(sizeof(seedData) == EntropyPool::SEED_BYTES, "EntropyPool::SEED_BYTES must cover one engine seed.");
+
+        EntropyPool::Fill(seedData.data(), sizeof(seedData));
+        std::seed_seq seq(seedData.begin(), seedData.end());
+        return std::mt19937(seq);
+    }
+};
+
+/// @brief Converts a stduuid value, which only this file sees
+Uuid FromStdUuid(const uuids::uuid& uuid)
+{
+    auto raw = uuid.as_bytes();
+    std::array<uint8_t, 16> bytes;
+    std::memcpy(bytes.data(), raw.data(), bytes.size());
+    return Uuid::FromBytes(bytes);
+}
+
+uuids::uuid ToStdUuid(const Uuid& uuid)
+{
+    std::array<uint8_t, 16> bytes = uuid.ToBytes();
+    return uuids::uuid{bytes.begin(), bytes.end()};
+}
+
+Counter& GeneratedCounter()
+{
+    static Counter& counter = Metrics::GetCounter("uuid.generated");
+    return counter;
+}
+
+RandomGenerator& LocalRandomGenerator()
+{
+    thread_local std::optional<RandomGenerator> state;
+
+    // A forked child inherits this thread's engine state; reseed so it does not replay the parent.
+    // Rebuilt in place since the generator may refer to the engine it was constructed with.
+    if (!state || state->generation != EntropyPool::Generation()) state.emplace();
+    return *state;
+}
+
+/// @brief Low bits of the shared GenerateNodeOrdered() state that count IDs within a millisecond
+constexpr unsigned NODE_ORDERED_COUNTER_BITS = 16;
+
+/// @brief Counter bits stored above the version nibble; the rest follow the variant bits
+constexpr unsigned NODE_ORDERED_COUNTER_HIGH_BITS = 12;
+
+constexpr uint64_t NODE_ID_MASK = (uint64_t{1} << Uuid::NODE_ID_BITS) - 1;
+constexpr uint64_t NODE_ID_SET = uint64_t{1} << 63;
+constexpr uint64_t NODE_ID_EXPLICIT = uint64_t{1} << 62;
+
+/// @brief Node ID in the low NODE_ID_BITS bits, flagged as set and as explicit; 0 until first use
+std::atomic<uint64_t> g_nodeId{0};
+
+/// @brief Last issued (milliseconds << NODE_ORDERED_COUNTER_BITS | counter), shared by every thread
+std::atomic<uint64_t> g_nodeOrderedState{0};
+
+uint64_t Mix64(uint64_t value)
+{
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+    return value ^ (value >> 31);
+}
+
+/// @brief Derives a node ID from the host name, the process ID and fresh entropy
+uint64_t DefaultNodeId()
+{
+    uint64_t random;
+    EntropyPool::Fill(&random, sizeof(random));
+
+#ifdef _WIN32
+    uint64_t identity = static_cast<uint64_t>(::_getpid());
+#else
+    uint64_t identity = static_cast<uint64_t>(::getpid());
+    char host[256] = {};
+    if (::gethostname(host, sizeof(host) - 1) == 0)
+    {
+        for (const char* c = host; *c != '\0'; ++c) identity = Mix64(identity ^ static_cast<unsigned char>(*c));
+    }
+#endif
+    // The random term alone makes a collision between N processes about N^2 / 2^59 likely
+    return Mix64(identity) ^ random;
+}
+
+#ifndef _WIN32
+/// @brief A forked child must not reuse its parent's derived node ID; explicit IDs are kept
+void ResetDefaultNodeIdInChild()
+{
+    if ((g_nodeId.load(std::memory_order_relaxed) & NODE_ID_EXPLICIT) == 0) g_nodeId.store(0, std::memory_order_relaxed);
+}
+
+const bool g_forkHandlerRegistered = ::pthread_atfork(nullptr, nullptr, ResetDefaultNodeIdInChild) == 0;
+#endif
+
+} // namespace
+
 // Public Fields
 
-const Uuid Uuid::INVALID = Uuid(uuids::uuid{});
+const Uuid Uuid::INVALID = Uuid(std::array<uint8_t, 16>{});
 
 // Constructors and Destructors
 
@@ -22,20 +154,13 @@ const Uuid Uuid::INVALID = Uuid(uuids::uuid{});
 
 Uuid Uuid::GenerateRandom()
 {
-    // Thread-local static generator for thread safety and performance
-    static thread_local auto generator = []() {
-        // Properly seed the generator with high-quality entropy
-        std::random_device rd;
-        auto seed_data = std::array<int, std::mt19937::state_size>{};
-        std::generate(std::begin(seed_data), std::end(seed_data), std::ref(rd));
-        std::seed_seq seq(std::begin(seed_data), std::end(seed_data));
-        std::mt19937 engine(seq);
-        
-        return uuids::uuid_random_generator{engine};
-    }();
-    
-    // Generate and wrap the UUID
-    return Uuid{generator()};
+    if (Metrics::IsEnabled()) GeneratedCounter().Add();
+    return FromStdUuid(LocalRandomGenerator().generator());
+}
+
+void Uuid::SeedCurrentThread()
+{
+    LocalRandomGenerator();
 }
 
 Uuid Uuid::GenerateSequential()
@@ -55,9 +180,62 @@ Uuid Uuid::GenerateSequential()
         bytes[15 - i] = static_cast<uint8_t>((id >> (i * 8)) & 0xFF);
     }
     
-    // Create UUID from byte array
-    uuids::uuid uuid{bytes.begin(), bytes.end()};
-    return Uuid{uuid};
+    return FromBytes(bytes);
+}
+
+Uuid Uuid::GenerateNodeOrdered()
+{
+    if (Metrics::IsEnabled()) GeneratedCounter().Add();
+
+    const uint64_t now = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count()) & 0xFFFFFFFFFFFFull;
+
+    // One process-wide word keeps IDs monotonic per node. Within a millisecond, or if the clock stepped
+    // back, the counter increments; its overflow carries into the millisecond, borrowing the next one.
+    uint64_t state = g_nodeOrderedState.load(std::memory_order_relaxed);
+    uint64_t next;
+    do
+    {
+        next = now > (state >> NODE_ORDERED_COUNTER_BITS) ? now << NODE_ORDERED_COUNTER_BITS : state + 1;
+    } while (!g_nodeOrderedState.compare_exchange_weak(state, next, std::memory_order_relaxed));
+
+    constexpr unsigned lowBits = NODE_ORDERED_COUNTER_BITS - NODE_ORDERED_COUNTER_HIGH_BITS;
+    const uint64_t milliseconds = next >> NODE_ORDERED_COUNTER_BITS;
+    const uint64_t counter = next & ((uint64_t{1} << NODE_ORDERED_COUNTER_BITS) - 1);
+
+    const uint64_t high = (milliseconds << 16)
+        | (uint64_t{0x8} << 12)                                         // Version 8 (custom)
+        | (counter >> lowBits);
+    const uint64_t low = (uint64_t{0x2} << 62)                          // RFC 4122 variant
+        | ((counter & ((uint64_t{1} << lowBits) - 1)) << NODE_ID_BITS)
+        | GetNodeId();
+
+    std::array<uint8_t, 16> bytes;
+    for (int i = 0; i < 8; ++i)
+    {
+        bytes[i] = static_cast<uint8_t>(high >> (56 - 8 * i));
+        bytes[8 + i] = static_cast<uint8_t>(low >> (56 - 8 * i));
+    }
+    return FromBytes(bytes);
+}
+
+void Uuid::SetNodeId(uint64_t nodeId)
+{
+    if (nodeId > NODE_ID_MASK)
+        throw std::invalid_argument("Uuid::SetNodeId() node IDs are limited to " + std::to_string(NODE_ID_BITS) + " bits.");
+    g_nodeId.store(NODE_ID_SET | NODE_ID_EXPLICIT | nodeId, std::memory_order_relaxed);
+}
+
+uint64_t Uuid::GetNodeId()
+{
+    uint64_t value = g_nodeId.load(std::memory_order_relaxed);
+    if (value == 0)
+    {
+        uint64_t expected = 0;
+        const uint64_t derived = NODE_ID_SET | (DefaultNodeId() & NODE_ID_MASK);
+        value = g_nodeId.compare_exchange_strong(expected, derived, std::memory_order_relaxed) ? derived : expected;
+    }
+    return value & NODE_ID_MASK;
 }
 
 Uuid Uuid::GenerateFromSeed(uint32_t seed)
@@ -69,10 +247,22 @@ Uuid Uuid::GenerateFromSeed(uint32_t seed)
     uuids::uuid_random_generator generator{engine};
     
     // Generate and wrap the UUID
-    return Uuid{generator()};
+    return FromStdUuid(generator());
 }
 
-Uuid Uuid::GenerateFromString(const std::string& seed)
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+// Private Methods
+
+// ----------------- UuidString -----------------
+
+// Public Methods
+
+Uuid UuidString::GenerateFromString(const std::string& seed)
 {
     static auto generator = []() {
         // Use a fixed namespace UUID for your engine
@@ -85,10 +275,16 @@ Uuid Uuid::GenerateFromString(const std::string& seed)
         return uuids::uuid_name_generator{velecs_namespace};
     }();
     
-    return Uuid{generator(seed)};
+    return FromStdUuid(generator(seed));
+}
+
+Uuid UuidString::GenerateFromName(const Uuid& parent, const std::string& name)
+{
+    uuids::uuid_name_generator generator{ToStdUuid(parent)};
+    return FromStdUuid(generator(name));
 }
 
-Uuid Uuid::GenerateFromStringHash(const std::string& seed)
+Uuid UuidString::GenerateFromStringHash(const std::string& seed)
 {
     // Hash the string to get a numeric seed
     std::hash<std::string> hasher;
@@ -98,39 +294,33 @@ Uuid Uuid::GenerateFromStringHash(const std::string& seed)
     uint32_t numericSeed = static_cast<uint32_t>(hashValue);
     
     // Use existing GenerateFromSeed method
-    return GenerateFromSeed(numericSeed);
+    return Uuid::GenerateFromSeed(numericSeed);
 }
 
-std::optional<Uuid> Uuid::FromString(const std::string& uuid)
+std::optional<Uuid> UuidString::FromString(const std::string& uuid)
 {
     auto opt = uuids::uuid::from_string(uuid);
     if (opt.has_value())
     {
-        return Uuid{opt.value()};  // Create Uuid from the unwrapped value
+        return FromStdUuid(opt.value());  // Create Uuid from the unwrapped value
     }
     return std::nullopt;  // Return empty optional
 }
 
-Uuid& Uuid::operator=(const Uuid& other)
+std::string UuidString::ToString(const Uuid& uuid)
 {
-    // If not self, assign from internal uuid
-    if (this != &other) _uuid = other._uuid;
-    return *this;
-}
+    static const char* hex = "0123456789abcdef";
 
-Uuid& Uuid::operator=(Uuid&& other) noexcept
-{
-    // If not self, move internal uuid
-    if (this != &other) _uuid = std::move(other._uuid);
-    return *this;
+    const std::array<uint8_t, 16> bytes = uuid.ToBytes();
+    std::string text;
+    text.reserve(36);
+    for (size_t i = 0; i < bytes.size(); ++i)
+    {
+        if (i == 4 || i == 6 || i == 8 || i == 10) text.push_back('-');
+        text.push_back(hex[bytes[i] >> 4]);
+        text.push_back(hex[bytes[i] & 0xF]);
+    }
+    return text;
 }
 
-// Protected Fields
-
-// Protected Methods
-
-// Private Fields
-
-// Private Methods
-
 } // namespace velecs::common
@@ -0,0 +1,389 @@
+/// @file    UuidAlgorithms.cpp
+/// @author  Matthew Green
+/// @date    2026-10-18 14:17:40
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/common/UuidAlgorithms.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <type_traits>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define VELECS_UUID_X86 1
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define VELECS_TARGET_AVX2
+#else
+#define VELECS_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+namespace velecs::common {
+
+namespace {
+
+static_assert(sizeof(Uuid) == 16 && std::is_standard_layout_v<Uuid>,
+    "UuidAlgorithms reads Uuid lists as packed 16-byte keys.");
+
+/// @brief 128-bit key whose (hi, lo) ordering matches Uuid::operator<
+struct Key {
+    uint64_t hi;
+    uint64_t lo;
+
+    bool operator<(const Key& other) const { return hi != other.hi ? hi < other.hi : lo < other.lo; }
+    bool operator==(const Key& other) const { return hi == other.hi && lo == other.lo; }
+};
+
+constexpr size_t RADIX_THRESHOLD = 256;
+
+const uint8_t* BytesOf(const Uuid* uuid)
+{
+    return reinterpret_cast<const uint8_t*>(uuid);
+}
+
+uint64_t LoadBigEndian64(const uint8_t* bytes)
+{
+    uint64_t value;
+    std::memcpy(&value, bytes, sizeof(value));
+#ifdef _MSC_VER
+    return _byteswap_uint64(value);
+#else
+    return __builtin_bswap64(value);
+#endif
+}
+
+Key LoadKey(const Uuid& uuid)
+{
+    const uint8_t* bytes = BytesOf(&uuid);
+    return {LoadBigEndian64(bytes), LoadBigEndian64(bytes + 8)};
+}
+
+Uuid StoreKey(const Key& key)
+{
+    std::array<uint8_t, 16> bytes;
+    for (int i = 0; i < 8; ++i)
+    {
+        bytes[i] = static_cast<uint8_t>(key.hi >> (56 - 8 * i));
+        bytes[8 + i] = static_cast<uint8_t>(key.lo >> (56 - 8 * i));
+    }
+    return Uuid::FromBytes(bytes);
+}
+
+// Scalar kernels
+
+size_t FindScalar(const uint8_t* bytes, size_t count, const uint8_t* needle)
+{
+    uint64_t targetHi, targetLo;
+    std::memcpy(&targetHi, needle, 8);
+    std::memcpy(&targetLo, needle + 8, 8);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        uint64_t hi, lo;
+        std::memcpy(&hi, bytes + i * 16, 8);
+        std::memcpy(&lo, bytes + i * 16 + 8, 8);
+        if (((hi ^ targetHi) | (lo ^ targetLo)) == 0) return i;
+    }
+    return count;
+}
+
+size_t CountScalar(const uint8_t* bytes, size_t count, const uint8_t* needle)
+{
+    uint64_t targetHi, targetLo;
+    std::memcpy(&targetHi, needle, 8);
+    std::memcpy(&targetLo, needle + 8, 8);
+
+    size_t matches = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        uint64_t hi, lo;
+        std::memcpy(&hi, bytes + i * 16, 8);
+        std::memcpy(&lo, bytes + i * 16 + 8, 8);
+        matches += ((hi ^ targetHi) | (lo ^ targetLo)) == 0;
+    }
+    return matches;
+}
+
+#ifdef VELECS_UUID_X86
+
+// AVX2 kernels: four UUIDs per iteration as four 64-bit lane compares per register pair.
+// A UUID matches when both of its lanes compare equal, i.e. bits (2k, 2k+1) of the lane mask are set.
+
+VELECS_TARGET_AVX2 uint32_t MatchMaskAvx2(const uint8_t* bytes, __m256i target)
+{
+    __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bytes));
+    __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bytes + 32));
+    uint32_t lanes = static_cast<uint32_t>(_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(a, target))))
+        | (static_cast<uint32_t>(_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(b, target)))) << 4);
+    return lanes & (lanes >> 1) & 0x55u;
+}
+
+VELECS_TARGET_AVX2 size_t FindAvx2(const uint8_t* bytes, size_t count, const uint8_t* needle)
+{
+    const __m256i target = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(needle)));
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        uint32_t matches = MatchMaskAvx2(bytes + i * 16, target);
+        if (matches != 0)
+        {
+            uint32_t lane = 0;
+            while ((matches & 1u) == 0) { matches >>= 2; ++lane; }
+            return i + lane;
+        }
+    }
+    size_t tail = FindScalar(bytes + i * 16, count - i, needle);
+    return i + tail;
+}
+
+VELECS_TARGET_AVX2 size_t CountAvx2(const uint8_t* bytes, size_t count, const uint8_t* needle)
+{
+    const __m256i target = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(needle)));
+
+    size_t matches = 0;
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        uint32_t mask = MatchMaskAvx2(bytes + i * 16, target);
+        matches += (mask & 1u) + ((mask >> 2) & 1u) + ((mask >> 4) & 1u) + ((mask >> 6) & 1u);
+    }
+    return matches + CountScalar(bytes + i * 16, count - i, needle);
+}
+
+bool CpuHasAvx2()
+{
+#ifdef _MSC_VER
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7) return false;
+
+    __cpuid(info, 1);
+    const bool osSavesYmm = (info[2] & (1 << 27)) != 0 && (_xgetbv(0) & 0x6) == 0x6;
+    if (!osSavesYmm) return false;
+
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+
+#endif
+
+using SearchKernel = size_t (*)(const uint8_t*, size_t, const uint8_t*);
+
+SearchKernel SelectFindKernel()
+{
+#ifdef VELECS_UUID_X86
+    if (CpuHasAvx2()) return FindAvx2;
+#endif
+    return FindScalar;
+}
+
+SearchKernel SelectCountKernel()
+{
+#ifdef VELECS_UUID_X86
+    if (CpuHasAvx2()) return CountAvx2;
+#endif
+    return CountScalar;
+}
+
+/// @brief LSD radix sort of keys[first, last) on one 64-bit half, skipping bytes every key shares
+/// @param useHigh Sort by Key::hi when true, Key::lo otherwise
+void RadixSortHalf(Key* keys, Key* scratch, size_t count, bool useHigh)
+{
+    auto half = [useHigh](const Key& key) { return useHigh ? key.hi : key.lo; };
+
+    std::array<std::array<uint32_t, 256>, 8> histograms{};
+    for (size_t i = 0; i < count; ++i)
+    {
+        const uint64_t value = half(keys[i]);
+        for (int byte = 0; byte < 8; ++byte)
+        {
+            ++histograms[byte][(value >> (8 * byte)) & 0xFF];
+        }
+    }
+
+    Key* source = keys;
+    Key* destination = scratch;
+    const uint64_t firstValue = half(keys[0]);
+
+    for (int byte = 0; byte < 8; ++byte)
+    {
+        auto& histogram = histograms[byte];
+        if (histogram[(firstValue >> (8 * byte)) & 0xFF] == count) continue; // Uniform byte, already in order
+
+        uint32_t offset = 0;
+        for (uint32_t& bucket : histogram)
+        {
+            uint32_t bucketCount = bucket;
+            bucket = offset;
+            offset += bucketCount;
+        }
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            const Key& key = source[i];
+            destination[histogram[(half(key) >> (8 * byte)) & 0xFF]++] = key;
+        }
+        std::swap(source, destination);
+    }
+
+    if (source != keys) std::copy(source, source + count, keys);
+}
+
+/// @brief Radix sorts by the high half, then orders each run of equal high halves by the low half
+void RadixSort(std::vector<Key>& keys)
+{
+    std::vector<Key> scratch(keys.size());
+    RadixSortHalf(keys.data(), scratch.data(), keys.size(), true);
+
+    size_t runStart = 0;
+    while (runStart < keys.size())
+    {
+        size_t runEnd = runStart + 1;
+        while (runEnd < keys.size() && keys[runEnd].hi == keys[runStart].hi) ++runEnd;
+
+        const size_t runLength = runEnd - runStart;
+        if (runLength >= RADIX_THRESHOLD)
+            RadixSortHalf(keys.data() + runStart, scratch.data(), runLength, false);
+        else if (runLength > 1)
+            std::sort(keys.begin() + runStart, keys.begin() + runEnd);
+
+        runStart = runEnd;
+    }
+}
+
+} // namespace
+
+// Public Fields
+
+// Constructors and Destructors
+
+// Public Methods
+
+size_t UuidAlgorithms::Find(const Uuid* data, size_t count, const Uuid& value)
+{
+    static const SearchKernel kernel = SelectFindKernel();
+    return kernel(BytesOf(data), count, BytesOf(&value));
+}
+
+size_t UuidAlgorithms::Count(const Uuid* data, size_t count, const Uuid& value)
+{
+    static const SearchKernel kernel = SelectCountKernel();
+    return kernel(BytesOf(data), count, BytesOf(&value));
+}
+
+void UuidAlgorithms::Sort(Uuid* data, size_t count)
+{
+    if (count < 2) return;
+
+    std::vector<Key> keys(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        keys[i] = LoadKey(data[i]);
+    }
+
+    if (count < RADIX_THRESHOLD)
+        std::sort(keys.begin(), keys.end());
+    else
+        RadixSort(keys);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        data[i] = StoreKey(keys[i]);
+    }
+}
+
+void UuidAlgorithms::SortAndDedup(std::vector<Uuid>& uuids)
+{
+    Sort(uuids);
+    uuids.erase(std::unique(uuids.begin(), uuids.end()), uuids.end());
+}
+
+std::vector<Uuid> UuidAlgorithms::Intersection(const std::vector<Uuid>& a, const std::vector<Uuid>& b)
+{
+    std::vector<Uuid> result;
+    result.reserve(std::min(a.size(), b.size()));
+
+    size_t i = 0, j = 0;
+    while (i < a.size() && j < b.size())
+    {
+        const Key left = LoadKey(a[i]);
+        const Key right = LoadKey(b[j]);
+        if (left < right) ++i;
+        else if (right < left) ++j;
+        else
+        {
+            result.push_back(a[i]);
+            ++i;
+            ++j;
+        }
+    }
+    return result;
+}
+
+std::vector<Uuid> UuidAlgorithms::Union(const std::vector<Uuid>& a, const std::vector<Uuid>& b)
+{
+    std::vector<Uuid> result;
+    result.reserve(a.size() + b.size());
+
+    size_t i = 0, j = 0;
+    while (i < a.size() && j < b.size())
+    {
+        const Key left = LoadKey(a[i]);
+        const Key right = LoadKey(b[j]);
+        if (left < right) result.push_back(a[i++]);
+        else if (right < left) result.push_back(b[j++]);
+        else
+        {
+            result.push_back(a[i]);
+            ++i;
+            ++j;
+        }
+    }
+    result.insert(result.end(), a.begin() + i, a.end());
+    result.insert(result.end(), b.begin() + j, b.end());
+    return result;
+}
+
+std::vector<Uuid> UuidAlgorithms::Difference(const std::vector<Uuid>& a, const std::vector<Uuid>& b)
+{
+    std::vector<Uuid> result;
+    result.reserve(a.size());
+
+    size_t i = 0, j = 0;
+    while (i < a.size() && j < b.size())
+    {
+        const Key left = LoadKey(a[i]);
+        const Key right = LoadKey(b[j]);
+        if (left < right) result.push_back(a[i++]);
+        else if (right < left) ++j;
+        else
+        {
+            ++i;
+            ++j;
+        }
+    }
+    result.insert(result.end(), a.begin() + i, a.end());
+    return result;
+}
+
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+// Private Methods
+
+} // namespace velecs::common
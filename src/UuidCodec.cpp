@@ -0,0 +1,328 @@
+/// @file    UuidCodec.cpp
+/// @author  Matthew Green
+/// @date    2026-10-18 14:49:15
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/common/UuidCodec.hpp"
+#include "velecs/common/UuidAlgorithms.hpp"
+#include "velecs/common/BitOps.hpp"
+
+#include <array>
+#include <cstring>
+#include <stdexcept>
+
+namespace velecs::common {
+
+namespace {
+
+constexpr size_t UUID_BYTES = 16;
+constexpr size_t MAX_VARINT_BYTES = 19; // ceil(128 / 7)
+
+/// @brief Continuation bit of each byte in a little-endian word of varint bytes
+constexpr uint64_t CONTINUATION_BITS = 0x8080808080808080ull;
+
+/// @brief Unsigned 128-bit integer in big-endian UUID byte order (portable, MSVC has no __int128)
+struct U128 {
+    uint64_t hi;
+    uint64_t lo;
+};
+
+U128 FromUuid(const Uuid& uuid)
+{
+    const std::array<uint8_t, 16> bytes = uuid.ToBytes();
+    U128 value{0, 0};
+    for (size_t i = 0; i < 8; ++i)
+    {
+        value.hi = (value.hi << 8) | bytes[i];
+        value.lo = (value.lo << 8) | bytes[8 + i];
+    }
+    return value;
+}
+
+Uuid ToUuid(const U128& value)
+{
+    std::array<uint8_t, 16> bytes;
+    for (size_t i = 0; i < 8; ++i)
+    {
+        bytes[i] = static_cast<uint8_t>(value.hi >> (56 - 8 * i));
+        bytes[8 + i] = static_cast<uint8_t>(value.lo >> (56 - 8 * i));
+    }
+    return Uuid::FromBytes(bytes);
+}
+
+U128 Subtract(const U128& a, const U128& b)
+{
+    return {a.hi - b.hi - (a.lo < b.lo ? 1 : 0), a.lo - b.lo};
+}
+
+U128 Add(const U128& a, const U128& b)
+{
+    const uint64_t lo = a.lo + b.lo;
+    return {a.hi + b.hi + (lo < a.lo ? 1 : 0), lo};
+}
+
+/// @brief Maps a two's complement difference to an unsigned value with small magnitudes near zero
+U128 ZigZagEncode(const U128& value)
+{
+    const uint64_t sign = (value.hi >> 63) ? ~uint64_t{0} : 0;
+    return {((value.hi << 1) | (value.lo >> 63)) ^ sign, (value.lo << 1) ^ sign};
+}
+
+U128 ZigZagDecode(const U128& value)
+{
+    const uint64_t sign = (value.lo & 1) ? ~uint64_t{0} : 0;
+    return {(value.hi >> 1) ^ sign, ((value.lo >> 1) | (value.hi << 63)) ^ sign};
+}
+
+void WriteVarint(std::vector<uint8_t>& out, uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        out.push_back(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(value));
+}
+
+void WriteVarint(std::vector<uint8_t>& out, U128 value)
+{
+    while (value.hi != 0 || value.lo >= 0x80)
+    {
+        out.push_back(static_cast<uint8_t>(value.lo | 0x80));
+        value.lo = (value.lo >> 7) | (value.hi << 57);
+        value.hi >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(value.lo));
+}
+
+uint64_t ReadVarint64(const uint8_t*& cursor, const uint8_t* end)
+{
+    uint64_t value = 0;
+    for (int shift = 0; shift < 64; shift += 7)
+    {
+        if (cursor == end) throw std::runtime_error("Truncated UUID encoding.");
+        const uint8_t byte = *cursor++;
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0)
+        {
+            // The tenth byte carries only bit 63; anything more is not a 64-bit value
+            if (shift == 63 && byte > 1) break;
+            return value;
+        }
+    }
+    throw std::runtime_error("Malformed varint in UUID encoding.");
+}
+
+/// @brief Reads eight bytes as a word whose lowest byte is the first (little-endian host, as in UuidAlgorithms)
+uint64_t LoadLittleEndian64(const uint8_t* data)
+{
+    uint64_t word;
+    std::memcpy(&word, data, sizeof(word));
+    return word;
+}
+
+/// @brief Packs the 7-bit payloads of up to eight varint bytes, first byte lowest, into 56 bits
+uint64_t CompactVarintBytes(uint64_t word)
+{
+    word &= ~CONTINUATION_BITS;
+    word = ((word & 0x7F007F007F007F00ull) >> 1) | (word & 0x007F007F007F007Full);
+    word = ((word & 0x3FFF00003FFF0000ull) >> 2) | (word & 0x00003FFF00003FFFull);
+    word = ((word & 0x0FFFFFFF00000000ull) >> 4) | (word & 0x000000000FFFFFFFull);
+    return word;
+}
+
+/// @brief Keeps the first length bytes of a little-endian word
+uint64_t FirstBytes(uint64_t word, unsigned length)
+{
+    return length >= 8 ? word : word & ((uint64_t{1} << (8 * length)) - 1);
+}
+
+U128 ReadVarint128(const uint8_t*& cursor, const uint8_t* end)
+{
+    // Fast path: sequential IDs produce single-byte deltas
+    if (cursor != end && (*cursor & 0x80) == 0) return {0, *cursor++};
+
+    // Varints of up to 16 bytes (112 bits) are decoded a word at a time: the terminating byte is found
+    // from the continuation bits and the payloads are packed with shifts, without a branch per byte
+    if (end - cursor >= 16)
+    {
+        const uint64_t first = LoadLittleEndian64(cursor);
+        const uint64_t firstStops = ~first & CONTINUATION_BITS;
+        if (firstStops != 0)
+        {
+            const unsigned length = CountTrailingZeros(firstStops) / 8 + 1;
+            cursor += length;
+            return {0, CompactVarintBytes(FirstBytes(first, length))};
+        }
+
+        const uint64_t second = LoadLittleEndian64(cursor + 8);
+        const uint64_t secondStops = ~second & CONTINUATION_BITS;
+        if (secondStops != 0)
+        {
+            const unsigned length = CountTrailingZeros(secondStops) / 8 + 1;
+            const uint64_t low = CompactVarintBytes(first);
+            const uint64_t high = CompactVarintBytes(FirstBytes(second, length));
+            cursor += 8 + length;
+            return {high >> 8, low | (high << 56)};
+        }
+    }
+
+    U128 value{0, 0};
+    for (size_t index = 0; index < MAX_VARINT_BYTES; ++index)
+    {
+        if (cursor == end) throw std::runtime_error("Truncated UUID encoding.");
+        const uint8_t byte = *cursor++;
+        const uint64_t bits = byte & 0x7F;
+        const size_t shift = index * 7;
+        if (shift < 64)
+        {
+            value.lo |= bits << shift;
+            if (shift > 57) value.hi |= bits >> (64 - shift);
+        }
+        else
+        {
+            value.hi |= bits << (shift - 64);
+        }
+        if ((byte & 0x80) == 0)
+        {
+            // The nineteenth byte carries only bits 126 and 127; anything more would be silently dropped
+            if (index == MAX_VARINT_BYTES - 1 && bits > 0x03) break;
+            return value;
+        }
+    }
+    throw std::runtime_error("Malformed varint in UUID encoding.");
+}
+
+/// @brief Parses the header, leaving the cursor at the first encoded UUID
+UuidCodec::Mode ReadHeader(const uint8_t*& cursor, const uint8_t* end, size_t& outCount)
+{
+    if (cursor == end) throw std::runtime_error("Empty UUID encoding.");
+
+    const uint8_t mode = *cursor++;
+    if (mode != static_cast<uint8_t>(UuidCodec::Mode::Raw) && mode != static_cast<uint8_t>(UuidCodec::Mode::Delta))
+        throw std::runtime_error("Unknown UUID encoding mode.");
+
+    outCount = static_cast<size_t>(ReadVarint64(cursor, end));
+    return static_cast<UuidCodec::Mode>(mode);
+}
+
+} // namespace
+
+// Public Fields
+
+// Constructors and Destructors
+
+// Public Methods
+
+std::vector<uint8_t> UuidCodec::Encode(const Uuid* data, size_t count, bool sort)
+{
+    std::vector<Uuid> sorted;
+    if (sort && count > 1)
+    {
+        sorted.assign(data, data + count);
+        UuidAlgorithms::Sort(sorted);
+        data = sorted.data();
+    }
+
+    std::vector<uint8_t> header;
+    WriteVarint(header, static_cast<uint64_t>(count));
+
+    const size_t rawSize = 1 + header.size() + count * UUID_BYTES;
+
+    std::vector<uint8_t> out;
+    out.reserve(rawSize);
+    out.push_back(static_cast<uint8_t>(Mode::Delta));
+    out.insert(out.end(), header.begin(), header.end());
+
+    U128 previous{0, 0};
+    for (size_t i = 0; i < count; ++i)
+    {
+        const U128 current = FromUuid(data[i]);
+        WriteVarint(out, ZigZagEncode(Subtract(current, previous)));
+        previous = current;
+
+        if (out.size() >= rawSize) break; // Deltas are not paying off
+    }
+
+    if (out.size() < rawSize || count == 0) return out;
+
+    out.clear();
+    out.push_back(static_cast<uint8_t>(Mode::Raw));
+    out.insert(out.end(), header.begin(), header.end());
+    for (size_t i = 0; i < count; ++i)
+    {
+        const std::array<uint8_t, 16> bytes = data[i].ToBytes();
+        out.insert(out.end(), bytes.begin(), bytes.end());
+    }
+    return out;
+}
+
+size_t UuidCodec::DecodedCount(const uint8_t* data, size_t size)
+{
+    const uint8_t* cursor = data;
+    size_t count = 0;
+    ReadHeader(cursor, data + size, count);
+    return count;
+}
+
+size_t UuidCodec::Decode(const uint8_t* data, size_t size, Uuid* out, size_t capacity)
+{
+    const uint8_t* cursor = data;
+    const uint8_t* end = data + size;
+
+    size_t count = 0;
+    const Mode mode = ReadHeader(cursor, end, count);
+    if (count > capacity)
+        throw std::runtime_error("UUID encoding holds more UUIDs than the destination capacity.");
+
+    if (mode == Mode::Raw)
+    {
+        if (static_cast<size_t>(end - cursor) != count * UUID_BYTES)
+            throw std::runtime_error("Raw UUID encoding has the wrong length.");
+
+        std::array<uint8_t, 16> bytes;
+        for (size_t i = 0; i < count; ++i, cursor += UUID_BYTES)
+        {
+            std::copy(cursor, cursor + UUID_BYTES, bytes.begin());
+            out[i] = Uuid::FromBytes(bytes);
+        }
+        return count;
+    }
+
+    U128 previous{0, 0};
+    for (size_t i = 0; i < count; ++i)
+    {
+        previous = Add(previous, ZigZagDecode(ReadVarint128(cursor, end)));
+        out[i] = ToUuid(previous);
+    }
+    if (cursor != end) throw std::runtime_error("Trailing bytes after UUID encoding.");
+    return count;
+}
+
+std::vector<Uuid> UuidCodec::Decode(const std::vector<uint8_t>& encoded)
+{
+    const size_t count = DecodedCount(encoded.data(), encoded.size());
+
+    // Each UUID takes at least one byte, which bounds the allocation for malformed counts
+    if (count > encoded.size())
+        throw std::runtime_error("UUID encoding count exceeds its length.");
+
+    std::vector<Uuid> uuids(count, Uuid::INVALID);
+    Decode(encoded.data(), encoded.size(), uuids.data(), uuids.size());
+    return uuids;
+}
+
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+// Private Methods
+
+} // namespace velecs::common
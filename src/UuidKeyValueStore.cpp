@@ -0,0 +1,815 @@
+/// @file    UuidKeyValueStore.cpp
+/// @author  Matthew Green
+/// @date    2026-10-18 16:47:12
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/common/UuidKeyValueStore.hpp"
+#include "velecs/common/Metrics.hpp"
+#include "velecs/common/Paths.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <optional>
+#include <stdexcept>
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#include <sys/stat.h>
+#else
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace velecs::common {
+
+namespace {
+
+constexpr char LOG_MAGIC[8] = {'V', 'L', 'K', 'V', 'L', 'O', 'G', '1'};
+constexpr size_t LOG_HEADER_SIZE = sizeof(LOG_MAGIC);
+
+/// @brief crc32 and payload length precede every record's payload
+constexpr size_t RECORD_HEADER_SIZE = 8;
+
+/// @brief op, key and value size precede every entry's value
+constexpr size_t ENTRY_HEADER_SIZE = 1 + 16 + 4;
+
+constexpr uint8_t OP_PUT = 1;
+constexpr uint8_t OP_DELETE = 2;
+
+constexpr size_t COMPACTION_RECORD_BYTES = 1024 * 1024;
+
+/// @brief Value bytes a scan copies out per index lock acquisition
+constexpr size_t SCAN_BATCH_BYTES = 256 * 1024;
+
+// Encoding helpers
+
+void AppendU32(std::vector<uint8_t>& out, uint32_t value)
+{
+    for (int i = 0; i < 4; ++i) out.push_back(static_cast<uint8_t>(value >> (8 * i)));
+}
+
+void StoreU32(uint8_t* out, uint32_t value)
+{
+    for (int i = 0; i < 4; ++i) out[i] = static_cast<uint8_t>(value >> (8 * i));
+}
+
+uint32_t LoadU32(const uint8_t* in)
+{
+    return static_cast<uint32_t>(in[0]) | (static_cast<uint32_t>(in[1]) << 8)
+        | (static_cast<uint32_t>(in[2]) << 16) | (static_cast<uint32_t>(in[3]) << 24);
+}
+
+void AppendEntry(std::vector<uint8_t>& out, uint8_t op, const Uuid& key, const void* data, size_t size)
+{
+    if (size > UINT32_MAX) throw std::length_error("UuidKeyValueStore values are limited to 4 GiB.");
+
+    out.push_back(op);
+    const std::array<uint8_t, 16> bytes = key.ToBytes();
+    out.insert(out.end(), bytes.begin(), bytes.end());
+    AppendU32(out, static_cast<uint32_t>(size));
+    if (size > 0)
+    {
+        const uint8_t* begin = static_cast<const uint8_t*>(data);
+        out.insert(out.end(), begin, begin + size);
+    }
+}
+
+uint32_t Crc32(const uint8_t* data, size_t size, uint32_t crc = 0)
+{
+    static const std::array<uint32_t, 256> table = [] {
+        std::array<uint32_t, 256> result{};
+        for (uint32_t i = 0; i < 256; ++i)
+        {
+            uint32_t value = i;
+            for (int bit = 0; bit < 8; ++bit) value = (value & 1) ? (0xEDB88320u ^ (value >> 1)) : (value >> 1);
+            result[i] = value;
+        }
+        return result;
+    }();
+
+    crc = ~crc;
+    for (size_t i = 0; i < size; ++i) crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    return ~crc;
+}
+
+/// @brief Builds a full record (crc, length, count, entries) from a batch's encoded entries
+std::vector<uint8_t> EncodeRecord(const std::vector<uint8_t>& entries, uint32_t count)
+{
+    std::vector<uint8_t> record(RECORD_HEADER_SIZE);
+    record.reserve(RECORD_HEADER_SIZE + 4 + entries.size());
+    AppendU32(record, count);
+    record.insert(record.end(), entries.begin(), entries.end());
+
+    const size_t payloadSize = record.size() - RECORD_HEADER_SIZE;
+    if (payloadSize > UINT32_MAX) throw std::length_error("UuidKeyValueStore batches are limited to 4 GiB.");
+
+    StoreU32(record.data() + 4, static_cast<uint32_t>(payloadSize));
+    StoreU32(record.data(), Crc32(record.data() + 4, record.size() - 4));
+    return record;
+}
+
+/// @brief Walks a record payload, validating bounds; returns false if it is malformed
+template<typename Func>
+bool ForEachEntry(const uint8_t* payload, size_t size, Func&& func)
+{
+    if (size < 4) return false;
+    const uint32_t count = LoadU32(payload);
+
+    size_t position = 4;
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        if (size - position < ENTRY_HEADER_SIZE) return false;
+        const uint8_t op = payload[position];
+        std::array<uint8_t, 16> key;
+        std::memcpy(key.data(), payload + position + 1, key.size());
+        const uint32_t valueSize = LoadU32(payload + position + 17);
+        position += ENTRY_HEADER_SIZE;
+
+        if ((op != OP_PUT && op != OP_DELETE) || size - position < valueSize) return false;
+        func(op, Uuid::FromBytes(key), position, valueSize);
+        position += valueSize;
+    }
+    return position == size;
+}
+
+// File helpers
+
+int OpenFile(const std::filesystem::path& path, bool truncate)
+{
+#ifdef _WIN32
+    int fd = -1;
+    const int flags = _O_RDWR | _O_CREAT | _O_BINARY | (truncate ? _O_TRUNC : 0);
+    _wsopen_s(&fd, path.c_str(), flags, _SH_DENYNO, _S_IREAD | _S_IWRITE);
+    return fd;
+#else
+    return ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC | (truncate ? O_TRUNC : 0), 0644);
+#endif
+}
+
+void CloseFile(int fd)
+{
+#ifdef _WIN32
+    _close(fd);
+#else
+    ::close(fd);
+#endif
+}
+
+uint64_t FileSize(int fd)
+{
+#ifdef _WIN32
+    return static_cast<uint64_t>(_filelengthi64(fd));
+#else
+    struct stat info{};
+    ::fstat(fd, &info);
+    return static_cast<uint64_t>(info.st_size);
+#endif
+}
+
+#ifdef _WIN32
+/// @brief Windows has no pread/pwrite on CRT descriptors; seek and transfer under one lock
+std::mutex g_positionMutex;
+#endif
+
+bool ReadAt(int fd, void* out, size_t size, uint64_t offset)
+{
+    uint8_t* cursor = static_cast<uint8_t*>(out);
+#ifdef _WIN32
+    std::lock_guard<std::mutex> lock(g_positionMutex);
+    if (_lseeki64(fd, static_cast<__int64>(offset), SEEK_SET) < 0) return false;
+    while (size > 0)
+    {
+        const int chunk = _read(fd, cursor, static_cast<unsigned int>(std::min<size_t>(size, 1u << 30)));
+        if (chunk <= 0) return false;
+        cursor += chunk;
+        size -= static_cast<size_t>(chunk);
+    }
+#else
+    while (size > 0)
+    {
+        const ssize_t chunk = ::pread(fd, cursor, size, static_cast<off_t>(offset));
+        if (chunk < 0 && errno == EINTR) continue;
+        if (chunk <= 0) return false;
+        cursor += chunk;
+        offset += static_cast<uint64_t>(chunk);
+        size -= static_cast<size_t>(chunk);
+    }
+#endif
+    return true;
+}
+
+void WriteAt(int fd, const void* data, size_t size, uint64_t offset)
+{
+    const uint8_t* cursor = static_cast<const uint8_t*>(data);
+#ifdef _WIN32
+    std::lock_guard<std::mutex> lock(g_positionMutex);
+    if (_lseeki64(fd, static_cast<__int64>(offset), SEEK_SET) < 0)
+        throw std::runtime_error("Failed to seek in key-value log.");
+    while (size > 0)
+    {
+        const int chunk = _write(fd, cursor, static_cast<unsigned int>(std::min<size_t>(size, 1u << 30)));
+        if (chunk <= 0) throw std::runtime_error("Failed to write key-value log.");
+        cursor += chunk;
+        size -= static_cast<size_t>(chunk);
+    }
+#else
+    while (size > 0)
+    {
+        const ssize_t chunk = ::pwrite(fd, cursor, size, static_cast<off_t>(offset));
+        if (chunk < 0 && errno == EINTR) continue;
+        if (chunk <= 0) throw std::runtime_error("Failed to write key-value log.");
+        cursor += chunk;
+        offset += static_cast<uint64_t>(chunk);
+        size -= static_cast<size_t>(chunk);
+    }
+#endif
+}
+
+void SyncFile(int fd)
+{
+#ifdef _WIN32
+    if (_commit(fd) != 0) throw std::runtime_error("Failed to sync key-value log.");
+#else
+    if (::fdatasync(fd) != 0) throw std::runtime_error("Failed to sync key-value log.");
+#endif
+}
+
+void TruncateFile(int fd, uint64_t size)
+{
+#ifdef _WIN32
+    if (_chsize_s(fd, static_cast<__int64>(size)) != 0)
+#else
+    if (::ftruncate(fd, static_cast<off_t>(size)) != 0)
+#endif
+        throw std::runtime_error("Failed to truncate key-value log.");
+}
+
+/// @brief Makes a rename durable by syncing the containing directory (no-op on Windows)
+void SyncDirectory(const std::filesystem::path& directory)
+{
+#ifndef _WIN32
+    const int fd = ::open(directory.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return;
+    ::fsync(fd);
+    ::close(fd);
+#else
+    (void)directory;
+#endif
+}
+
+std::filesystem::path DefaultPath(const std::string& name)
+{
+    std::filesystem::path directory = Paths::PersistentDataDir() / "KeyValue";
+    std::filesystem::create_directories(directory);
+    return directory / (name + ".vlkv");
+}
+
+// Metrics are looked up only behind Metrics::IsEnabled(), so nothing is registered when they are off
+
+Histogram& AppendLatency()
+{
+    static Histogram& histogram = Metrics::GetHistogram("kvstore.append_ns");
+    return histogram;
+}
+
+Histogram& ReadLatency()
+{
+    static Histogram& histogram = Metrics::GetHistogram("kvstore.read_ns");
+    return histogram;
+}
+
+Counter& CommitCounter()
+{
+    static Counter& counter = Metrics::GetCounter("kvstore.commits");
+    return counter;
+}
+
+Counter& CommitGroupCounter()
+{
+    static Counter& counter = Metrics::GetCounter("kvstore.commit_groups");
+    return counter;
+}
+
+} // namespace
+
+// Public Fields
+
+// Constructors and Destructors
+
+UuidKeyValueStore::UuidKeyValueStore(const std::string& name)
+    : UuidKeyValueStore(DefaultPath(name), Options{})
+{
+}
+
+UuidKeyValueStore::UuidKeyValueStore(const std::string& name, const Options& options)
+    : UuidKeyValueStore(DefaultPath(name), options)
+{
+}
+
+UuidKeyValueStore::UuidKeyValueStore(const std::filesystem::path& file, const Options& options)
+    : _path(file), _options(options)
+{
+    _fd = OpenFile(_path, false);
+    if (_fd < 0)
+        throw std::runtime_error("Failed to open key-value log '" + _path.string() + "'.");
+
+    try
+    {
+        Recover();
+    }
+    catch (...)
+    {
+        CloseFile(_fd);
+        throw;
+    }
+
+    if (_options.backgroundCompaction)
+        _compactionThread = std::thread(&UuidKeyValueStore::CompactionLoop, this);
+}
+
+UuidKeyValueStore::~UuidKeyValueStore()
+{
+    if (_compactionThread.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> lock(_compactionMutex);
+            _stopCompaction = true;
+        }
+        _compactionCv.notify_all();
+        _compactionThread.join();
+    }
+
+    if (_fd >= 0) CloseFile(_fd);
+}
+
+// Public Methods
+
+void UuidKeyValueStore::WriteBatch::Put(const Uuid& key, const void* data, size_t size)
+{
+    AppendEntry(_entries, OP_PUT, key, data, size);
+    ++_count;
+}
+
+void UuidKeyValueStore::WriteBatch::Delete(const Uuid& key)
+{
+    AppendEntry(_entries, OP_DELETE, key, nullptr, 0);
+    ++_count;
+}
+
+void UuidKeyValueStore::Put(const Uuid& key, const void* data, size_t size)
+{
+    WriteBatch batch;
+    batch.Put(key, data, size);
+    Write(batch);
+}
+
+void UuidKeyValueStore::Delete(const Uuid& key)
+{
+    WriteBatch batch;
+    batch.Delete(key);
+    Write(batch);
+}
+
+void UuidKeyValueStore::Write(const WriteBatch& batch)
+{
+    if (batch.Empty()) return;
+
+    const std::vector<uint8_t> record = EncodeRecord(batch._entries, batch._count);
+    CommitRequest request{&record, false, nullptr};
+
+    std::unique_lock<std::mutex> lock(_commitMutex);
+    _commitQueue.push_back(&request);
+
+    // Followers wait for a leader to commit their record; the first writer with no active leader leads
+    _commitCv.wait(lock, [this, &request] { return request.done || !_leaderActive; });
+    if (!request.done)
+    {
+        _leaderActive = true;
+        std::vector<CommitRequest*> group;
+        group.swap(_commitQueue);
+        lock.unlock();
+
+        std::exception_ptr error;
+        try
+        {
+            AppendGroup(group);
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+
+        lock.lock();
+        for (CommitRequest* member : group)
+        {
+            member->error = error;
+            member->done = true;
+        }
+        _leaderActive = false;
+        _commitCv.notify_all();
+    }
+
+    if (request.error) std::rethrow_exception(request.error);
+}
+
+bool UuidKeyValueStore::TryGet(const Uuid& key, std::vector<uint8_t>& outValue) const
+{
+    std::shared_lock<std::shared_mutex> lock(_indexMutex);
+    auto it = _index.find(key);
+    if (it == _index.end()) return false;
+
+    ReadValue(it->second, outValue);
+    return true;
+}
+
+std::optional<std::vector<uint8_t>> UuidKeyValueStore::Get(const Uuid& key) const
+{
+    std::vector<uint8_t> value;
+    if (!TryGet(key, value)) return std::nullopt;
+    return value;
+}
+
+bool UuidKeyValueStore::Contains(const Uuid& key) const
+{
+    std::shared_lock<std::shared_mutex> lock(_indexMutex);
+    return _index.find(key) != _index.end();
+}
+
+void UuidKeyValueStore::ScanRange(const Uuid& first, const Uuid& last, const ScanCallback& callback) const
+{
+    Scan(&first, &last, callback);
+}
+
+void UuidKeyValueStore::ForEach(const ScanCallback& callback) const
+{
+    Scan(nullptr, nullptr, callback);
+}
+
+void UuidKeyValueStore::Compact()
+{
+    std::lock_guard<std::mutex> compactLock(_compactMutex);
+
+    // Snapshot the live entries and the end of the log they describe; writers keep appending past it
+    std::vector<std::pair<Uuid, Location>> live;
+    uint64_t snapshotEnd;
+    {
+        std::shared_lock<std::shared_mutex> lock(_indexMutex);
+        live.assign(_index.begin(), _index.end());
+        snapshotEnd = _fileSize;
+    }
+
+    std::filesystem::path compactPath = _path;
+    compactPath += ".compact";
+
+    const int out = OpenFile(compactPath, true);
+    if (out < 0)
+        throw std::runtime_error("Failed to create compacted key-value log '" + compactPath.string() + "'.");
+
+    std::map<Uuid, Location> index;
+    uint64_t size = LOG_HEADER_SIZE;
+    std::unique_lock<std::mutex> appendLock(_appendMutex, std::defer_lock);
+    std::vector<uint8_t> tail;
+    try
+    {
+        WriteAt(out, LOG_MAGIC, LOG_HEADER_SIZE, 0);
+
+        std::vector<uint8_t> entries;
+        std::vector<uint8_t> value;
+        std::vector<std::pair<Uuid, uint32_t>> pending;
+
+        auto flush = [&] {
+            if (pending.empty()) return;
+
+            const std::vector<uint8_t> record = EncodeRecord(entries, static_cast<uint32_t>(pending.size()));
+            WriteAt(out, record.data(), record.size(), size);
+
+            uint64_t valueOffset = size + RECORD_HEADER_SIZE + 4;
+            for (const auto& [key, valueSize] : pending)
+            {
+                valueOffset += ENTRY_HEADER_SIZE;
+                index.emplace_hint(index.end(), key, Location{valueOffset, valueSize});
+                valueOffset += valueSize;
+            }
+            size += record.size();
+            entries.clear();
+            pending.clear();
+        };
+
+        // Only compaction replaces _fd and the snapshot's bytes are never rewritten, so no lock is needed here
+        for (const auto& [key, location] : live)
+        {
+            ReadValue(location, value);
+            AppendEntry(entries, OP_PUT, key, value.data(), value.size());
+            pending.emplace_back(key, location.size);
+            if (entries.size() >= COMPACTION_RECORD_BYTES) flush();
+        }
+        flush();
+        SyncFile(out);
+
+        // Block writers only to carry over the records appended since the snapshot
+        appendLock.lock();
+        tail.resize(static_cast<size_t>(_fileSize - snapshotEnd));
+        if (!tail.empty())
+        {
+            if (!ReadAt(_fd, tail.data(), tail.size(), snapshotEnd))
+                throw std::runtime_error("Failed to read key-value log '" + _path.string() + "'.");
+            WriteAt(out, tail.data(), tail.size(), size);
+            SyncFile(out);
+        }
+    }
+    catch (...)
+    {
+        CloseFile(out);
+        std::error_code ignored;
+        std::filesystem::remove(compactPath, ignored);
+        throw;
+    }
+    CloseFile(out);
+
+    std::unique_lock<std::shared_mutex> lock(_indexMutex);
+
+    // Close before renaming so the swap also works where open files cannot be replaced
+    CloseFile(_fd);
+    std::error_code renameError;
+    std::filesystem::rename(compactPath, _path, renameError);
+    if (renameError)
+    {
+        _fd = OpenFile(_path, false);
+        std::filesystem::remove(compactPath, renameError);
+        throw std::runtime_error("Failed to replace key-value log '" + _path.string() + "' with its compacted copy.");
+    }
+    SyncDirectory(_path.parent_path());
+
+    _fd = OpenFile(_path, false);
+    if (_fd < 0)
+        throw std::runtime_error("Failed to reopen compacted key-value log '" + _path.string() + "'.");
+
+    _index.swap(index);
+    _garbageBytes = 0;
+
+    // Replay the carried-over records at their new offsets; they were validated when first appended
+    for (size_t position = 0; position < tail.size();)
+    {
+        const uint32_t length = LoadU32(tail.data() + position + 4);
+        ApplyRecord(tail.data() + position + RECORD_HEADER_SIZE, length, size + position + RECORD_HEADER_SIZE);
+        position += RECORD_HEADER_SIZE + length;
+    }
+    _fileSize = size + tail.size();
+}
+
+size_t UuidKeyValueStore::Size() const
+{
+    std::shared_lock<std::shared_mutex> lock(_indexMutex);
+    return _index.size();
+}
+
+uint64_t UuidKeyValueStore::FileBytes() const
+{
+    std::shared_lock<std::shared_mutex> lock(_indexMutex);
+    return _fileSize;
+}
+
+uint64_t UuidKeyValueStore::GarbageBytes() const
+{
+    std::shared_lock<std::shared_mutex> lock(_indexMutex);
+    return _garbageBytes;
+}
+
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+// Private Methods
+
+void UuidKeyValueStore::Recover()
+{
+    const uint64_t fileSize = FileSize(_fd);
+    if (fileSize < LOG_HEADER_SIZE)
+    {
+        // New or torn before the header was complete
+        TruncateFile(_fd, 0);
+        WriteAt(_fd, LOG_MAGIC, LOG_HEADER_SIZE, 0);
+        SyncFile(_fd);
+        _fileSize = LOG_HEADER_SIZE;
+        return;
+    }
+
+    char magic[LOG_HEADER_SIZE];
+    if (!ReadAt(_fd, magic, LOG_HEADER_SIZE, 0) || std::memcmp(magic, LOG_MAGIC, LOG_HEADER_SIZE) != 0)
+        throw std::runtime_error("'" + _path.string() + "' is not a key-value log.");
+
+    uint64_t offset = LOG_HEADER_SIZE;
+    std::vector<uint8_t> payload;
+    while (offset + RECORD_HEADER_SIZE <= fileSize)
+    {
+        uint8_t header[RECORD_HEADER_SIZE];
+        if (!ReadAt(_fd, header, RECORD_HEADER_SIZE, offset)) break;
+
+        const uint32_t crc = LoadU32(header);
+        const uint32_t length = LoadU32(header + 4);
+        if (length > fileSize - offset - RECORD_HEADER_SIZE) break;
+
+        payload.resize(length);
+        if (!ReadAt(_fd, payload.data(), length, offset + RECORD_HEADER_SIZE)) break;
+        if (Crc32(payload.data(), length, Crc32(header + 4, 4)) != crc) break;
+
+        const uint64_t payloadOffset = offset + RECORD_HEADER_SIZE;
+        if (!ForEachEntry(payload.data(), length, [](uint8_t, const Uuid&, size_t, uint32_t) {})) break;
+
+        ApplyRecord(payload.data(), length, payloadOffset);
+        offset = payloadOffset + length;
+    }
+
+    if (offset < fileSize)
+    {
+        // Torn or corrupt tail from a crash mid-append: drop it
+        TruncateFile(_fd, offset);
+        SyncFile(_fd);
+    }
+    _fileSize = offset;
+}
+
+void UuidKeyValueStore::AppendGroup(const std::vector<CommitRequest*>& group)
+{
+    std::lock_guard<std::mutex> appendLock(_appendMutex);
+    if (Metrics::IsEnabled())
+    {
+        CommitCounter().Add(group.size());
+        CommitGroupCounter().Add();
+    }
+
+    std::vector<uint8_t> buffer;
+    for (const CommitRequest* request : group)
+    {
+        buffer.insert(buffer.end(), request->record->begin(), request->record->end());
+    }
+
+    // Only this thread appends, so the end of the file cannot move underneath it
+    const uint64_t start = _fileSize;
+    {
+        std::optional<ScopedTimer> timer;
+        if (Metrics::IsEnabled()) timer.emplace(AppendLatency());
+        try
+        {
+            WriteAt(_fd, buffer.data(), buffer.size(), start);
+            if (_options.syncOnCommit) SyncFile(_fd);
+        }
+        catch (...)
+        {
+            // The group is reported as not applied, so drop whatever part of it reached the file;
+            // otherwise Recover() would replay it on the next open
+            try
+            {
+                TruncateFile(_fd, start);
+            }
+            catch (const std::exception&)
+            {
+                // Keep the original error; the next append starts at the same offset and overwrites the tail
+            }
+            throw;
+        }
+    }
+
+    bool compact = false;
+    {
+        std::unique_lock<std::shared_mutex> lock(_indexMutex);
+        uint64_t offset = start;
+        for (const CommitRequest* request : group)
+        {
+            const std::vector<uint8_t>& record = *request->record;
+            ApplyRecord(record.data() + RECORD_HEADER_SIZE, record.size() - RECORD_HEADER_SIZE, offset + RECORD_HEADER_SIZE);
+            offset += record.size();
+        }
+        _fileSize = offset;
+        compact = _options.backgroundCompaction && ShouldCompact();
+    }
+
+    if (compact)
+    {
+        {
+            std::lock_guard<std::mutex> lock(_compactionMutex);
+            _compactionRequested = true;
+        }
+        _compactionCv.notify_all();
+    }
+}
+
+void UuidKeyValueStore::ApplyRecord(const uint8_t* payload, size_t size, uint64_t payloadOffset)
+{
+    // Record framing and the count are charged as garbage up front rather than when the record's last
+    // live entry dies, which would need per-record reference counts; this overstates garbage by at most
+    // that much per record still holding live entries
+    _garbageBytes += RECORD_HEADER_SIZE + 4;
+
+    ForEachEntry(payload, size, [this, payloadOffset](uint8_t op, const Uuid& key, size_t position, uint32_t valueSize) {
+        auto it = _index.find(key);
+        if (it != _index.end())
+        {
+            _garbageBytes += ENTRY_HEADER_SIZE + it->second.size;
+            if (op == OP_DELETE) _index.erase(it);
+        }
+
+        if (op == OP_PUT)
+        {
+            const Location location{payloadOffset + position, valueSize};
+            if (it != _index.end()) it->second = location;
+            else _index.emplace(key, location);
+        }
+        else
+        {
+            _garbageBytes += ENTRY_HEADER_SIZE;
+        }
+    });
+}
+
+void UuidKeyValueStore::Scan(const Uuid* first, const Uuid* last, const ScanCallback& callback) const
+{
+    std::vector<Uuid> keys;
+    std::vector<std::vector<uint8_t>> values;
+    std::optional<Uuid> resume;
+    while (true)
+    {
+        // Copy a batch out under the lock so callbacks run unlocked and may write to the store
+        size_t count = 0;
+        keys.clear();
+        {
+            std::shared_lock<std::shared_mutex> lock(_indexMutex);
+            auto it = resume ? _index.upper_bound(*resume) : (first ? _index.lower_bound(*first) : _index.begin());
+            size_t bytes = 0;
+            for (; it != _index.end() && (!last || it->first < *last) && bytes < SCAN_BATCH_BYTES; ++it)
+            {
+                if (count == values.size()) values.emplace_back();
+                ReadValue(it->second, values[count]);
+                keys.push_back(it->first);
+                bytes += ENTRY_HEADER_SIZE + it->second.size;
+                ++count;
+            }
+        }
+        if (count == 0) return;
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (!callback(keys[i], values[i])) return;
+        }
+        resume = keys.back();
+    }
+}
+
+void UuidKeyValueStore::ReadValue(const Location& location, std::vector<uint8_t>& outValue) const
+{
+    std::optional<ScopedTimer> timer;
+    if (Metrics::IsEnabled()) timer.emplace(ReadLatency());
+
+    outValue.resize(location.size);
+    if (location.size > 0 && !ReadAt(_fd, outValue.data(), location.size, location.offset))
+        throw std::runtime_error("Failed to read key-value log '" + _path.string() + "'.");
+}
+
+bool UuidKeyValueStore::ShouldCompact() const
+{
+    return _garbageBytes >= _options.compactionMinGarbageBytes
+        && static_cast<double>(_garbageBytes) >= _options.compactionGarbageRatio * static_cast<double>(_fileSize);
+}
+
+void UuidKeyValueStore::CompactionLoop()
+{
+    std::unique_lock<std::mutex> lock(_compactionMutex);
+    while (!_stopCompaction)
+    {
+        _compactionCv.wait_for(lock, std::chrono::seconds(5), [this] { return _stopCompaction || _compactionRequested; });
+        if (_stopCompaction) break;
+        _compactionRequested = false;
+
+        bool compact;
+        {
+            std::shared_lock<std::shared_mutex> indexLock(_indexMutex);
+            compact = ShouldCompact();
+        }
+        if (!compact) continue;
+
+        lock.unlock();
+        try
+        {
+            Compact();
+        }
+        catch (const std::exception&)
+        {
+            // The original log is intact; retry on the next wake-up
+        }
+        lock.lock();
+    }
+}
+
+} // namespace velecs::common
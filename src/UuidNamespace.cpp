@@ -0,0 +1,60 @@
+/// @file    UuidNamespace.cpp
+/// @author  Matthew Green
+/// @date    2026-10-18 13:52:08
+/// 
+/// @section LICENSE
+/// 
+/// Copyright (c) 2025 Matthew Green - All rights reserved
+/// Unauthorized copying of this file, via any medium is strictly prohibited
+/// Proprietary and confidential
+
+#include "velecs/common/UuidNamespace.hpp"
+
+#include <uuid.h> // `#include <stduuid/include/uuid.h>` does not work unfortunately.
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+
+namespace velecs::common {
+
+// Public Fields
+
+// Constructors and Destructors
+
+UuidNamespace::UuidNamespace(const Uuid& parent)
+    : _parent(parent) {}
+
+// Public Methods
+
+Uuid UuidNamespace::Derive(std::string_view name) const
+{
+    // The 16 parent bytes never fill a SHA-1 block, so there is no compression work to cache
+    const std::array<uint8_t, 16> parentBytes = _parent.ToBytes();
+    uuids::detail::sha1 hasher;
+    hasher.process_bytes(parentBytes.data(), parentBytes.size());
+    hasher.process_bytes(name.data(), name.size());
+
+    uuids::detail::sha1::digest8_t digest;
+    hasher.get_digest_bytes(digest);
+
+    // RFC 4122 version 5 and variant bits, as applied by uuids::uuid_name_generator
+    digest[8] &= 0xBF;
+    digest[8] |= 0x80;
+    digest[6] &= 0x5F;
+    digest[6] |= 0x50;
+
+    std::array<uint8_t, 16> bytes;
+    std::copy(digest, digest + 16, bytes.begin());
+    return Uuid::FromBytes(bytes);
+}
+
+// Protected Fields
+
+// Protected Methods
+
+// Private Fields
+
+// Private Methods
+
+} // namespace velecs::common